@@ -0,0 +1,6 @@
+#!/bin/sh
+
+for unit in color event file math render scene sprite text time window
+do
+  xembed unit/gamma/$unit.agate src/units/$unit.agate.h gamma_unit_$unit
+done
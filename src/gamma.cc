@@ -4,6 +4,7 @@
  */
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include <SDL2/SDL.h>
 
@@ -11,20 +12,57 @@
 
 #include "gamma_color.h"
 #include "gamma_event.h"
+#include "gamma_file.h"
 #include "gamma_math.h"
 #include "gamma_render.h"
+#include "gamma_replay.h"
+#include "gamma_sdl.h"
 #include "gamma_sprite.h"
 #include "gamma_support.h"
 #include "gamma_text.h"
 #include "gamma_time.h"
 #include "gamma_window.h"
 
-#include "gamecontrollerdb.txt.h"
+#include "units/color.agate.h"
+#include "units/event.agate.h"
+#include "units/file.agate.h"
+#include "units/math.agate.h"
+#include "units/render.agate.h"
+#include "units/scene.agate.h"
+#include "units/sprite.agate.h"
+#include "units/text.agate.h"
+#include "units/time.agate.h"
+#include "units/window.agate.h"
 
 #include "config.h"
 
 static void usage(void) {
-  std::printf("Usage: gamma <unit>\n");
+  std::printf("Usage: gamma [--pack <pack>]... [--units <directory>] [--profile-startup | --profile-json <file>] [--record <replay> | --replay <replay>] <unit>\n");
+  std::printf("       gamma --convert-qoi <image>...\n");
+}
+
+// rewrite the images in place in the QOI format, the loader recognizes QOI by its magic so scripts keep the same names
+static int convert_qoi(int count, char *filenames[]) {
+  int status = EXIT_SUCCESS;
+
+  for (int i = 0; i < count; ++i) {
+    gma::Image image(filenames[i]);
+
+    if (!image.loaded()) {
+      std::fprintf(stderr, "Unable to load image: '%s'.\n", filenames[i]);
+      status = EXIT_FAILURE;
+      continue;
+    }
+
+    if (!image.save_qoi(filenames[i])) {
+      std::fprintf(stderr, "Unable to save image: '%s'.\n", filenames[i]);
+      status = EXIT_FAILURE;
+    }
+
+    image.destroy();
+  }
+
+  return status;
 }
 
 static void print(AgateVM *vm, const char* text) {
@@ -56,30 +94,95 @@ static void input(AgateVM *vm, char *buffer, size_t size) {
 }
 
 int main(int argc, char *argv[]) {
-  if (argc != 2) {
+  const int64_t main_start = gma::time_now();
+  auto & profile = gma::StartupProfile::get();
+
+  if (argc >= 2 && std::strcmp(argv[1], "--convert-qoi") == 0) {
+    return convert_qoi(argc - 2, argv + 2);
+  }
+
+  int index = 1;
+  const char *unit_directory = nullptr;
+  bool profile_startup = false;
+
+  while (index < argc && std::strncmp(argv[index], "--", 2) == 0) {
+    if (std::strcmp(argv[index], "--pack") == 0 && index + 1 < argc) {
+      if (!gma::mount_pack(argv[index + 1])) {
+        std::fprintf(stderr, "Unable to mount pack: '%s'.\n", argv[index + 1]);
+        return EXIT_FAILURE;
+      }
+
+      index += 2;
+    } else if (std::strcmp(argv[index], "--units") == 0 && index + 1 < argc) {
+      // development override of the embedded units
+      unit_directory = argv[index + 1];
+
+      if (std::error_code error; !std::filesystem::is_directory(unit_directory, error)) {
+        std::fprintf(stderr, "Not a directory: '%s'.\n", unit_directory);
+        return EXIT_FAILURE;
+      }
+
+      index += 2;
+    } else if (std::strcmp(argv[index], "--record") == 0 && index + 1 < argc && !gma::Replay::get().replaying()) {
+      if (!gma::Replay::get().start_recording(argv[index + 1])) {
+        std::fprintf(stderr, "Unable to record replay: '%s'.\n", argv[index + 1]);
+        return EXIT_FAILURE;
+      }
+
+      index += 2;
+    } else if (std::strcmp(argv[index], "--replay") == 0 && index + 1 < argc && !gma::Replay::get().recording()) {
+      if (!gma::Replay::get().start_replay(argv[index + 1])) {
+        std::fprintf(stderr, "Unable to load replay: '%s'.\n", argv[index + 1]);
+        return EXIT_FAILURE;
+      }
+
+      index += 2;
+    } else if (std::strcmp(argv[index], "--profile-startup") == 0) {
+      profile_startup = true;
+      index += 1;
+    } else if (std::strcmp(argv[index], "--profile-json") == 0 && index + 1 < argc) {
+      // implies --profile-startup
+      profile_startup = true;
+      profile.json_filename = argv[index + 1];
+      index += 2;
+    } else {
+      usage();
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (index + 1 != argc) {
     usage();
     return EXIT_FAILURE;
   }
 
+  const char *unit = argv[index];
+
+  if (profile_startup) {
+    profile.start(main_start);
+  }
+
   // initialize FreeType
 
+  auto freetype_phase = profile.begin("freetype");
+
   if (FT_Error err; (err = FT_Init_FreeType(&gma::Font::library)) != 0) {
     std::fprintf(stderr, "Unable to load FreeType: %s\n", gma::Font::error_message(err));
     return EXIT_FAILURE;
   }
 
-  // initialize SDL
+  profile.end(freetype_phase);
 
-  if (SDL_Init(SDL_INIT_EVERYTHING) != 0) {
+  // initialize SDL, the subsystems are initialized when they are first needed
+
+  auto sdl_phase = profile.begin("sdl");
+
+  if (SDL_Init(0) != 0) {
     std::fprintf(stderr, "Unable to initialize SDL: %s\n", SDL_GetError());
     return EXIT_FAILURE;
   }
 
-  int added = SDL_GameControllerAddMappingsFromRW(SDL_RWFromConstMem(gamma_gamecontrollerdb, sizeof gamma_gamecontrollerdb), 1);
-
-  if (added == -1) {
-    std::fprintf(stderr, "Unable to load game controller mappings: %s\n", SDL_GetError());
-  }
+  profile.end(sdl_phase);
 
   // initialize Agate
 
@@ -99,12 +202,34 @@ int main(int argc, char *argv[]) {
 
   config.user_data = &support;
 
+  auto vm_phase = profile.begin("vm");
   AgateVM *vm = agateNewVM(&config);
+  profile.end(vm_phase);
+
+  auto support_phase = profile.begin("support");
 
-  support.add_include_path(GAMMA_UNIT_DIRECTORY);
+  if (unit_directory != nullptr) {
+    support.add_override_path(unit_directory);
+  }
+
+  support.add_embedded_unit("gamma/color", gamma_unit_color);
+  support.add_embedded_unit("gamma/event", gamma_unit_event);
+  support.add_embedded_unit("gamma/file", gamma_unit_file);
+  support.add_embedded_unit("gamma/math", gamma_unit_math);
+  support.add_embedded_unit("gamma/render", gamma_unit_render);
+  support.add_embedded_unit("gamma/scene", gamma_unit_scene);
+  support.add_embedded_unit("gamma/sprite", gamma_unit_sprite);
+  support.add_embedded_unit("gamma/text", gamma_unit_text);
+  support.add_embedded_unit("gamma/time", gamma_unit_time);
+  support.add_embedded_unit("gamma/window", gamma_unit_window);
+
+  if (std::error_code error; std::filesystem::is_directory(GAMMA_UNIT_DIRECTORY, error)) {
+    support.add_include_path(GAMMA_UNIT_DIRECTORY);
+  }
 
   gma::ColorUnit::provide_support(support);
   gma::EventUnit::provide_support(support);
+  gma::FileUnit::provide_support(support);
   gma::MathUnit::provide_support(support);
   gma::RenderUnit::provide_support(support);
   gma::SpriteUnit::provide_support(support);
@@ -112,27 +237,56 @@ int main(int argc, char *argv[]) {
   gma::TimeUnit::provide_support(support);
   gma::WindowUnit::provide_support(support);
 
+  profile.end(support_phase);
+
   // run the game
 
-  const char *source = support.load_unit(argv[1]);
+  auto load_phase = profile.begin("load unit");
+  const char *source = support.load_unit(unit);
+  profile.end(load_phase);
 
   if (source != nullptr) {
-    std::filesystem::path script_path(argv[1]);
+    std::filesystem::path script_path(unit);
     std::filesystem::path script_directory = script_path.parent_path();
 
-    if (!script_directory.empty()) {
+    // names on disk are relative to the directory of the main unit
+    if (std::error_code error; !script_directory.empty() && std::filesystem::is_directory(script_directory, error)) {
       std::filesystem::current_path(script_directory);
     }
 
-    agateCallString(vm, argv[1], source);
+    // the packs follow the main unit only if it was found in a pack, the directory is then relative to the root of the pack
+    std::filesystem::path unit_filename = script_path.lexically_normal();
+    unit_filename.replace_extension("agate");
+
+    if (gma::PackFile packed; gma::find_in_packs(unit_filename.generic_string(), packed)) {
+      gma::set_pack_directory(unit_filename.parent_path().generic_string());
+    }
+
+    // the script phase ends with the first frame, or with the script if it never displays anything
+    profile.begin("script until first frame");
+
+    // the main unit may start a frame loop that runs once the unit has returned
+    if (agateCallString(vm, unit, source) == AGATE_STATUS_OK) {
+      gma::run_frame_loop(vm);
+    }
   } else {
-    std::fprintf(stderr, "Could not find gamma unit '%s'.\n", argv[1]);
+    std::fprintf(stderr, "Could not find gamma unit '%s'.\n", unit);
   }
 
+  profile.finish();
+
   // shutdown Agate
 
   agateDeleteVM(vm);
 
+  // the units and the assets of the packs are not used anymore
+
+  gma::unmount_packs();
+
+  // write the end of the recording
+
+  gma::Replay::get().stop();
+
   // shutdown SDL
 
   SDL_Quit();
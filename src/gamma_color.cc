@@ -14,73 +14,62 @@ namespace gma {
    * Color
    */
 
-  namespace {
-
-    struct HSV {
-      float h;
-      float s;
-      float v;
-      float a;
-    };
-
-    static HSV convert_rgb_to_hsv(const Color & color) {
-      const float r = color.r;
-      const float g = color.g;
-      const float b = color.b;
-
-      const auto [ min, max ] = std::minmax({ r, g, b });
-
-      HSV hsv;
-
-      if ((max - min) > std::numeric_limits<float>::epsilon()) {
-        if (max == r) {
-          hsv.h = std::fmod(60.0f * (g - b) / (max - min) + 360.0f, 360.0f);
-        } else if (max == g) {
-          hsv.h = 60.0f * (b - r) / (max - min) + 120.0f;
-        } else if (max == b) {
-          hsv.h = 60.0f * (r - g) / (max - min) + 240.0f;
-        } else {
-          assert(false);
-        }
+  HSV convert_rgb_to_hsv(const Color & color) {
+    const float r = color.r;
+    const float g = color.g;
+    const float b = color.b;
+
+    const auto [ min, max ] = std::minmax({ r, g, b });
+
+    HSV hsv;
+
+    if ((max - min) > std::numeric_limits<float>::epsilon()) {
+      if (max == r) {
+        hsv.h = std::fmod(60.0f * (g - b) / (max - min) + 360.0f, 360.0f);
+      } else if (max == g) {
+        hsv.h = 60.0f * (b - r) / (max - min) + 120.0f;
+      } else if (max == b) {
+        hsv.h = 60.0f * (r - g) / (max - min) + 240.0f;
       } else {
-        hsv.h = 0.0f;
+        assert(false);
       }
-
-      hsv.s = (max < std::numeric_limits<float>::epsilon() ? 0.0f : (1.0f - min / max));
-      hsv.v = max;
-      hsv.a = color.a;
-      return hsv;
+    } else {
+      hsv.h = 0.0f;
     }
 
-    static Color convert_hsv_to_rgb(const HSV & hsv) {
-      const float h = hsv.h / 60.0f;
-      const float s = hsv.s;
-      const float v = hsv.v;
-
-      const int i = static_cast<int>(h) % 6;
-      assert(0 <= i && i < 6);
-
-      const float f = h - static_cast<float>(i);
-      const float x = v * (1.0f - s);
-      const float y = v * (1.0f - (f * s));
-      const float z = v * (1.0f - (1.0f - f) * s);
-
-      Color color = { 0.0f, 0.0f, 0.0f, 0.0f };
-
-      switch (i) {
-        case 0: color.r = v; color.g = z; color.b = x; break;
-        case 1: color.r = y; color.g = v; color.b = x; break;
-        case 2: color.r = x; color.g = v; color.b = z; break;
-        case 3: color.r = x; color.g = y; color.b = v; break;
-        case 4: color.r = z; color.g = x; color.b = v; break;
-        case 5: color.r = v; color.g = x; color.b = y; break;
-        default: assert(false); break;
-      }
+    hsv.s = (max < std::numeric_limits<float>::epsilon() ? 0.0f : (1.0f - min / max));
+    hsv.v = max;
+    hsv.a = color.a;
+    return hsv;
+  }
 
-      color.a = hsv.a;
-      return color;
+  Color convert_hsv_to_rgb(const HSV & hsv) {
+    const float h = hsv.h / 60.0f;
+    const float s = hsv.s;
+    const float v = hsv.v;
+
+    const int i = static_cast<int>(h) % 6;
+    assert(0 <= i && i < 6);
+
+    const float f = h - static_cast<float>(i);
+    const float x = v * (1.0f - s);
+    const float y = v * (1.0f - (f * s));
+    const float z = v * (1.0f - (1.0f - f) * s);
+
+    Color color = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    switch (i) {
+      case 0: color.r = v; color.g = z; color.b = x; break;
+      case 1: color.r = y; color.g = v; color.b = x; break;
+      case 2: color.r = x; color.g = v; color.b = z; break;
+      case 3: color.r = x; color.g = y; color.b = v; break;
+      case 4: color.r = z; color.g = x; color.b = v; break;
+      case 5: color.r = v; color.g = x; color.b = y; break;
+      default: assert(false); break;
     }
 
+    color.a = hsv.a;
+    return color;
   }
 
   Color Color::darker(float ratio) const {
@@ -56,6 +56,16 @@ namespace gma {
     return lhs.r != rhs.r || lhs.g != rhs.g || lhs.b != rhs.b || lhs.a != rhs.a;
   }
 
+  struct HSV {
+    float h;
+    float s;
+    float v;
+    float a;
+  };
+
+  HSV convert_rgb_to_hsv(const Color & color);
+  Color convert_hsv_to_rgb(const HSV & hsv);
+
   template<>
   struct TypeName<Color> {
     static constexpr const char *name = "Color";
@@ -1,9 +1,16 @@
 #include "gamma_event.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
 
 #include "gamma_agate.h"
 #include "gamma_math.h"
+#include "gamma_replay.h"
+#include "gamma_sdl.h"
+#include "gamma_time.h"
 
 namespace gma {
 
@@ -98,101 +105,1475 @@ namespace gma {
       return EventType::UNKNOWN;
     }
 
-    static void event_new_foreign(AgateVM *vm, const char *class_name, SDL_Event *raw) {
+    // the script class of an event, or nullptr if the event is not exposed to scripts
+    static const char *compute_event_class(const SDL_Event *event) {
+      assert(event);
+
+      switch (event->type) {
+        case SDL_WINDOWEVENT:
+          switch (event->window.event) {
+            case SDL_WINDOWEVENT_SIZE_CHANGED:
+              return "ResizeEvent";
+            case SDL_WINDOWEVENT_CLOSE:
+            case SDL_WINDOWEVENT_FOCUS_GAINED:
+            case SDL_WINDOWEVENT_FOCUS_LOST:
+            case SDL_WINDOWEVENT_ENTER:
+            case SDL_WINDOWEVENT_LEAVE:
+            case SDL_WINDOWEVENT_SHOWN:
+            case SDL_WINDOWEVENT_HIDDEN:
+            case SDL_WINDOWEVENT_EXPOSED:
+            case SDL_WINDOWEVENT_MINIMIZED:
+            case SDL_WINDOWEVENT_MAXIMIZED:
+            case SDL_WINDOWEVENT_RESTORED:
+              return "__GenericWindowEvent";
+            default:
+              return nullptr;
+          }
+          break;
+        case SDL_QUIT:
+          return "__GenericEvent";
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+          return "KeyboardEvent";
+        case SDL_MOUSEWHEEL:
+          return "MouseWheelEvent";
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+          return "MouseButtonEvent";
+        case SDL_MOUSEMOTION:
+          return "MouseMotionEvent";
+        case SDL_CONTROLLERDEVICEADDED:
+        case SDL_CONTROLLERDEVICEREMOVED:
+        case SDL_CONTROLLERBUTTONDOWN:
+        case SDL_CONTROLLERBUTTONUP:
+        case SDL_CONTROLLERAXISMOTION:
+        case SDL_TEXTINPUT:
+        case SDL_FINGERDOWN:
+        case SDL_FINGERMOTION:
+        case SDL_FINGERUP:
+          return "__GenericEvent";
+        default:
+          return nullptr;
+      }
+
+      return nullptr;
+    }
+
+    static void event_new_foreign(AgateVM *vm, const char *class_name, const SDL_Event *raw) {
       ptrdiff_t class_slot = agateSlotAllocate(vm);
       agateGetVariable(vm, unit_name, class_name, class_slot);
       Event *event = static_cast<Event *>(agateSlotSetForeign(vm, AGATE_RETURN_SLOT, class_slot));
       *event = *raw;
     }
 
-    static bool event_new(AgateVM *vm, SDL_Event *event) {
-      assert(event);
+    static bool event_new(AgateVM *vm, const SDL_Event *event) {
+      const char *class_name = compute_event_class(event);
+
+      if (class_name == nullptr) {
+        return false;
+      }
+
+      event_new_foreign(vm, class_name, event);
+      return true;
+    }
+
+    // methods
+
+    // the next event comes from SDL, or from the replay in which case the live events are dropped
+    static bool next_event(SDL_Event& event) {
+      auto & replay = Replay::get();
+
+      if (replay.replaying()) {
+        SDL_PumpEvents();
+        SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+        return replay.poll_event(event);
+      }
+
+      if (SDL_PollEvent(&event) == 0) {
+        InputState::get().events_drained = true;
+        return false;
+      }
+
+      replay.record_event(event);
+      return true;
+    }
+
+    static bool peek_event(SDL_Event& event) {
+      auto & replay = Replay::get();
+
+      if (replay.replaying()) {
+        return replay.peek_event(event);
+      }
+
+      return SDL_PeepEvents(&event, 1, SDL_PEEKEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) == 1;
+    }
+
+    // every event updates the input state, even the ones that are not exposed to scripts
+    static void process_event(const SDL_Event& event) {
+      if (event.type == SDL_JOYDEVICEADDED) {
+        sdl_load_gamepad_mappings();
+      }
+
+      InputState::get().process(event);
+    }
+
+    // put the next event in the return slot, or return false if there is none
+    static bool generic_poll(AgateVM *vm) {
+      SDL_Event event;
+      auto & coalescer = EventCoalescer::get();
+
+      for (;;) {
+        if (!next_event(event)) {
+          return false;
+        }
+
+        process_event(event);
+
+        if (coalescer.enabled) {
+          SDL_Event next;
+
+          // the events that are not exposed are skipped, like in Event.poll_all()
+          while (peek_event(next)) {
+            if (compute_event_class(&next) != nullptr && !coalescer.merge(event, next)) {
+              break;
+            }
+
+            next_event(next);
+            process_event(next);
+          }
+
+          if (!coalescer.keep(event)) {
+            continue;
+          }
+        }
+
+        if (event_new(vm, &event)) {
+          return true;
+        }
+      }
+    }
+
+    static void poll(AgateVM *vm) {
+      // gamepads are only reported by the game controller subsystem
+      if (!sdl_require(SDL_INIT_EVENTS | SDL_INIT_GAMECONTROLLER)) {
+        agateError(vm, "Unable to initialize events: %s", SDL_GetError());
+        return;
+      }
+
+      if (!generic_poll(vm)) {
+        agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+      }
+    }
+
+    // timeout in nanoseconds, negative to wait forever
+    static void generic_wait(AgateVM *vm, int64_t timeout) {
+      if (!sdl_require(SDL_INIT_EVENTS | SDL_INIT_GAMECONTROLLER)) {
+        agateError(vm, "Unable to initialize events: %s", SDL_GetError());
+        return;
+      }
+
+      // a replay must not depend on the time spent waiting
+      if (Replay::get().replaying()) {
+        if (!generic_poll(vm)) {
+          agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+        }
+
+        return;
+      }
+
+      const int64_t deadline = time_now() + timeout;
+
+      for (;;) {
+        // the event is left in the queue, so that it goes through the usual path
+        if (timeout < 0) {
+          if (SDL_WaitEvent(nullptr) == 0) {
+            agateError(vm, "Unable to wait for an event: %s", SDL_GetError());
+            return;
+          }
+        } else {
+          const int64_t remaining = deadline - time_now();
+
+          // rounded up, so that the deadline is reached before giving up
+          const int milliseconds = static_cast<int>(std::clamp<int64_t>((remaining + 999999) / 1000000, 0, INT32_MAX));
+
+          if (SDL_WaitEventTimeout(nullptr, milliseconds) == 0) {
+            agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+            return;
+          }
+        }
+
+        // background work is ready, the frame must go on even without any input
+        const bool woken = sdl_flush_wake();
+
+        // the event that woke us up may not be exposed to scripts
+        if (generic_poll(vm)) {
+          return;
+        }
+
+        if (woken) {
+          agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+          return;
+        }
+
+        if (timeout >= 0 && time_now() >= deadline) {
+          agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+          return;
+        }
+      }
+    }
+
+    static void wait0(AgateVM *vm) {
+      generic_wait(vm, -1);
+    }
+
+    static void wait1(AgateVM *vm) {
+      int64_t timeout;
+
+      if (!agateCheck(vm, 1, timeout)) {
+        agateError(vm, "Int parameter expected for `timeout`.");
+        return;
+      }
+
+      if (timeout < 0) {
+        agateError(vm, "Timeout must be positive.");
+        return;
+      }
+
+      generic_wait(vm, timeout);
+    }
+
+    static void poll_all(AgateVM *vm) {
+      if (!sdl_require(SDL_INIT_EVENTS | SDL_INIT_GAMECONTROLLER)) {
+        agateError(vm, "Unable to initialize events: %s", SDL_GetError());
+        return;
+      }
+
+      auto & queue = EventQueue::get();
+      queue.poll();
+
+      auto buffer = agateSlotNew<EventBufferClass>(vm, AGATE_RETURN_SLOT);
+      buffer->generation = queue.generation;
+    }
+
+    static void coalescing(AgateVM *vm) {
+      agateSlotSetBool(vm, AGATE_RETURN_SLOT, EventCoalescer::get().enabled);
+    }
+
+    static void coalescing_setter(AgateVM *vm) {
+      bool value;
+
+      if (!agateCheck(vm, 1, value)) {
+        agateError(vm, "Bool parameter expected for `value`.");
+        return;
+      }
+
+      EventCoalescer::get().enabled = value;
+      agateSlotCopy(vm, AGATE_RETURN_SLOT, 1);
+    }
+
+    static void axis_threshold(AgateVM *vm) {
+      agateSlotSetFloat(vm, AGATE_RETURN_SLOT, EventCoalescer::get().axis_threshold / 32767.0);
+    }
+
+    static void axis_threshold_setter(AgateVM *vm) {
+      float value;
+
+      if (!agateCheck(vm, 1, value)) {
+        agateError(vm, "Float parameter expected for `value`.");
+        return;
+      }
+
+      if (value < 0.0f || value > 1.0f) {
+        agateError(vm, "Axis threshold must be in [0, 1].");
+        return;
+      }
+
+      EventCoalescer::get().axis_threshold = static_cast<int>(std::lround(value * 32767.0f));
+      agateSlotCopy(vm, AGATE_RETURN_SLOT, 1);
+    }
+
+    static void type(AgateVM *vm) {
+      assert(agateCheckTag<EventClass>(vm, 0));
+      auto event = agateSlotGet<EventClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(compute_event_kind(event)));
+    }
+
+    #define X(name)                 \
+    static void name(AgateVM *vm) { \
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(EventType::name)); \
+    }
+
+    GAMMA_EVENT_TYPE_LIST
+
+    #undef X
+
+  };
+
+  /*
+   * EventBuffer
+   */
+
+  void EventQueue::poll() {
+    static constexpr int ChunkSize = 64;
+
+    events.clear();
+    ++generation;
+
+    SDL_PumpEvents();
+
+    if (auto & replay = Replay::get(); replay.replaying()) {
+      SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+      for (SDL_Event event; replay.poll_event(event); ) {
+        events.push_back(event);
+      }
+    } else {
+      for (;;) {
+        std::size_t size = events.size();
+        events.resize(size + ChunkSize);
+
+        int count = SDL_PeepEvents(events.data() + size, ChunkSize, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+        if (count < 0) {
+          count = 0;
+        }
+
+        events.resize(size + count);
+
+        if (count < ChunkSize) {
+          break;
+        }
+      }
+
+      InputState::get().events_drained = true;
+
+      if (replay.recording()) {
+        for (auto & event : events) {
+          replay.record_event(event);
+        }
+      }
+    }
+
+    // keep the events that Event.poll() would have returned
+    auto last = std::remove_if(events.begin(), events.end(), [](const SDL_Event& event) {
+      EventApi::process_event(event);
+      return EventApi::compute_event_class(&event) == nullptr;
+    });
+
+    events.erase(last, events.end());
+
+    if (auto & coalescer = EventCoalescer::get(); coalescer.enabled) {
+      std::size_t kept = 0;
+
+      for (auto & event : events) {
+        if (kept > 0 && coalescer.merge(events[kept - 1], event)) {
+          continue;
+        }
+
+        events[kept++] = event;
+      }
+
+      events.resize(kept);
+
+      events.erase(std::remove_if(events.begin(), events.end(), [&coalescer](const SDL_Event& event) {
+        return !coalescer.keep(event);
+      }), events.end());
+    }
+  }
+
+  bool EventCoalescer::merge(SDL_Event& event, const SDL_Event& next) const {
+    if (event.type != next.type) {
+      return false;
+    }
+
+    switch (event.type) {
+      case SDL_MOUSEMOTION:
+        if (event.motion.which != next.motion.which || event.motion.windowID != next.motion.windowID) {
+          return false;
+        }
+
+        event.motion.timestamp = next.motion.timestamp;
+        event.motion.state = next.motion.state;
+        event.motion.x = next.motion.x;
+        event.motion.y = next.motion.y;
+        event.motion.xrel += next.motion.xrel;
+        event.motion.yrel += next.motion.yrel;
+        return true;
+
+      case SDL_CONTROLLERAXISMOTION:
+        if (event.caxis.which != next.caxis.which || event.caxis.axis != next.caxis.axis) {
+          return false;
+        }
+
+        event.caxis = next.caxis;
+        return true;
+
+      default:
+        return false;
+    }
+  }
+
+  bool EventCoalescer::keep(const SDL_Event& event) {
+    if (event.type != SDL_CONTROLLERAXISMOTION || event.caxis.axis >= SDL_CONTROLLER_AXIS_MAX) {
+      return true;
+    }
+
+    auto iterator = std::find_if(last_axis_values.begin(), last_axis_values.end(), [&event](const AxisValues& axes) {
+      return axes.which == event.caxis.which;
+    });
+
+    if (iterator == last_axis_values.end()) {
+      last_axis_values.push_back({ event.caxis.which, { } });
+      iterator = std::prev(last_axis_values.end());
+    }
+
+    int16_t & last = iterator->values[event.caxis.axis];
+
+    if (std::abs(event.caxis.value - last) < axis_threshold) {
+      return false;
+    }
+
+    last = event.caxis.value;
+    return true;
+  }
+
+  EventCoalescer& EventCoalescer::get() {
+    static EventCoalescer coalescer;
+    return coalescer;
+  }
+
+  EventQueue& EventQueue::get() {
+    static EventQueue queue;
+    return queue;
+  }
+
+  struct EventBufferApi : EventBufferClass {
+
+    static const SDL_Event *get_event(AgateVM *vm) {
+      assert(agateCheckTag<EventBufferClass>(vm, 0));
+      auto buffer = agateSlotGet<EventBufferClass>(vm, 0);
+      auto & queue = EventQueue::get();
+
+      if (buffer->generation != queue.generation) {
+        agateError(vm, "Event buffer has been replaced by a later poll.");
+        return nullptr;
+      }
+
+      int64_t index;
+
+      if (!agateCheck(vm, 1, index)) {
+        agateError(vm, "Int parameter expected for `index`.");
+        return nullptr;
+      }
+
+      if (index < 0 || static_cast<std::size_t>(index) >= queue.events.size()) {
+        agateError(vm, "Index out of the buffer.");
+        return nullptr;
+      }
+
+      return &queue.events[index];
+    }
+
+    static bool is_keyboard(const SDL_Event *event) {
+      return event->type == SDL_KEYDOWN || event->type == SDL_KEYUP;
+    }
+
+    static bool is_mouse_button(const SDL_Event *event) {
+      return event->type == SDL_MOUSEBUTTONDOWN || event->type == SDL_MOUSEBUTTONUP;
+    }
+
+    static void count(AgateVM *vm) {
+      assert(agateCheckTag<EventBufferClass>(vm, 0));
+      auto buffer = agateSlotGet<EventBufferClass>(vm, 0);
+      auto & queue = EventQueue::get();
+
+      if (buffer->generation != queue.generation) {
+        agateError(vm, "Event buffer has been replaced by a later poll.");
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(queue.events.size()));
+    }
+
+    static void subscript_getter(AgateVM *vm) {
+      if (auto event = get_event(vm); event != nullptr) {
+        EventApi::event_new(vm, event);
+      }
+    }
+
+    static void type(AgateVM *vm) {
+      if (auto event = get_event(vm); event != nullptr) {
+        agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(EventApi::compute_event_kind(event)));
+      }
+    }
+
+    static void window_id(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      switch (event->type) {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+          agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->key.windowID);
+          break;
+        case SDL_MOUSEMOTION:
+          agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->motion.windowID);
+          break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+          agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->button.windowID);
+          break;
+        case SDL_MOUSEWHEEL:
+          agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->wheel.windowID);
+          break;
+        case SDL_WINDOWEVENT:
+          agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->window.windowID);
+          break;
+        default:
+          agateError(vm, "Event has no window.");
+          break;
+      }
+    }
+
+    static void pressed(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (is_keyboard(event)) {
+        agateSlotSetBool(vm, AGATE_RETURN_SLOT, event->key.state == SDL_PRESSED);
+      } else if (is_mouse_button(event)) {
+        agateSlotSetBool(vm, AGATE_RETURN_SLOT, event->button.state == SDL_PRESSED);
+      } else {
+        agateError(vm, "Keyboard or mouse button event expected.");
+      }
+    }
+
+    static void repeat(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (!is_keyboard(event)) {
+        agateError(vm, "Keyboard event expected.");
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->key.repeat);
+    }
+
+    static void scancode(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (!is_keyboard(event)) {
+        agateError(vm, "Keyboard event expected.");
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->key.keysym.scancode);
+    }
+
+    static void keycode(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (!is_keyboard(event)) {
+        agateError(vm, "Keyboard event expected.");
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->key.keysym.sym);
+    }
+
+    static void modifiers(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (!is_keyboard(event)) {
+        agateError(vm, "Keyboard event expected.");
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->key.keysym.mod);
+    }
+
+    static void button(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (!is_mouse_button(event)) {
+        agateError(vm, "Mouse button event expected.");
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->button.button);
+    }
+
+    static void clicks(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (!is_mouse_button(event)) {
+        agateError(vm, "Mouse button event expected.");
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->button.clicks);
+    }
+
+    static void coordinates(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (event->type == SDL_MOUSEMOTION) {
+        auto coordinates = agateSlotNew<Vec2IClass>(vm, AGATE_RETURN_SLOT);
+        coordinates->x = event->motion.x;
+        coordinates->y = event->motion.y;
+      } else if (is_mouse_button(event)) {
+        auto coordinates = agateSlotNew<Vec2IClass>(vm, AGATE_RETURN_SLOT);
+        coordinates->x = event->button.x;
+        coordinates->y = event->button.y;
+      } else {
+        agateError(vm, "Mouse motion or mouse button event expected.");
+      }
+    }
+
+    static void motion(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (event->type != SDL_MOUSEMOTION) {
+        agateError(vm, "Mouse motion event expected.");
+        return;
+      }
+
+      auto motion = agateSlotNew<Vec2IClass>(vm, AGATE_RETURN_SLOT);
+      motion->x = event->motion.xrel;
+      motion->y = event->motion.yrel;
+    }
+
+    // the components of coordinates(_) and motion(_), without a Vec2I for each event
+
+    static void x(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (event->type == SDL_MOUSEMOTION) {
+        agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->motion.x);
+      } else if (is_mouse_button(event)) {
+        agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->button.x);
+      } else {
+        agateError(vm, "Mouse motion or mouse button event expected.");
+      }
+    }
+
+    static void y(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (event->type == SDL_MOUSEMOTION) {
+        agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->motion.y);
+      } else if (is_mouse_button(event)) {
+        agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->button.y);
+      } else {
+        agateError(vm, "Mouse motion or mouse button event expected.");
+      }
+    }
+
+    static void dx(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (event->type != SDL_MOUSEMOTION) {
+        agateError(vm, "Mouse motion event expected.");
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->motion.xrel);
+    }
+
+    static void dy(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (event->type != SDL_MOUSEMOTION) {
+        agateError(vm, "Mouse motion event expected.");
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, event->motion.yrel);
+    }
+
+    static void offset(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (event->type != SDL_MOUSEWHEEL) {
+        agateError(vm, "Mouse wheel event expected.");
+        return;
+      }
+
+      auto offset = agateSlotNew<Vec2IClass>(vm, AGATE_RETURN_SLOT);
+
+      if (event->wheel.direction == SDL_MOUSEWHEEL_NORMAL) {
+        offset->x = event->wheel.x;
+        offset->y = event->wheel.y;
+      } else {
+        assert(event->wheel.direction == SDL_MOUSEWHEEL_FLIPPED);
+        offset->x = - event->wheel.x;
+        offset->y = - event->wheel.y;
+      }
+    }
+
+    static void size(AgateVM *vm) {
+      auto event = get_event(vm);
+
+      if (event == nullptr) {
+        return;
+      }
+
+      if (event->type != SDL_WINDOWEVENT || event->window.event != SDL_WINDOWEVENT_SIZE_CHANGED) {
+        agateError(vm, "Resize event expected.");
+        return;
+      }
+
+      auto size = agateSlotNew<Vec2IClass>(vm, AGATE_RETURN_SLOT);
+      size->x = event->window.data1;
+      size->y = event->window.data2;
+    }
+
+  };
+
+  /*
+   * Input
+   */
+
+  namespace {
+
+    uint32_t compute_mouse_button_mask(int64_t button) {
+      if (button < 1 || button > 32) {
+        return 0;
+      }
+
+      return SDL_BUTTON(button);
+    }
+
+    uint32_t compute_gamepad_button_mask(int64_t button) {
+      if (button < 0 || button >= SDL_CONTROLLER_BUTTON_MAX) {
+        return 0;
+      }
+
+      return UINT32_C(1) << button;
+    }
+
+  }
+
+  void InputState::process(const SDL_Event& event) {
+    switch (event.type) {
+      case SDL_KEYDOWN:
+        if (event.key.repeat == 0) {
+          key_downs.set(event.key.keysym.scancode);
+        }
+        event_keys.set(event.key.keysym.scancode);
+        break;
+      case SDL_KEYUP:
+        key_ups.set(event.key.keysym.scancode);
+        event_keys.reset(event.key.keysym.scancode);
+        break;
+      case SDL_MOUSEMOTION:
+        event_mouse_x = event.motion.x;
+        event_mouse_y = event.motion.y;
+        break;
+      case SDL_MOUSEBUTTONDOWN:
+        mouse_button_downs |= compute_mouse_button_mask(event.button.button);
+        event_mouse_buttons |= compute_mouse_button_mask(event.button.button);
+        break;
+      case SDL_MOUSEBUTTONUP:
+        mouse_button_ups |= compute_mouse_button_mask(event.button.button);
+        event_mouse_buttons &= ~compute_mouse_button_mask(event.button.button);
+        break;
+      case SDL_CONTROLLERBUTTONDOWN:
+        if (auto gamepad = find_gamepad(event.cbutton.which); gamepad != nullptr) {
+          gamepad_button_downs[gamepad - gamepads] |= compute_gamepad_button_mask(event.cbutton.button);
+        }
+        break;
+      case SDL_CONTROLLERBUTTONUP:
+        if (auto gamepad = find_gamepad(event.cbutton.which); gamepad != nullptr) {
+          gamepad_button_ups[gamepad - gamepads] |= compute_gamepad_button_mask(event.cbutton.button);
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  void InputState::update() {
+    // the state is only refreshed by the event loop of SDL, but pumping after the events have been drained would change
+    // the state for events that are still in the queue, and their transitions would be counted twice
+    if (!events_drained) {
+      SDL_PumpEvents();
+    }
+
+    events_drained = false;
+
+    const bool replaying = Replay::get().replaying();
+
+    // keyboard
+
+    previous_keys = keys;
+
+    if (replaying) {
+      keys = event_keys;
+    } else {
+      int count = 0;
+      const Uint8 *state = SDL_GetKeyboardState(&count);
+      count = std::min(count, SDL_NUM_SCANCODES);
+
+      keys.reset();
+
+      for (int i = 0; i < count; ++i) {
+        if (state[i] != 0) {
+          keys.set(i);
+        }
+      }
+    }
+
+    pressed_keys = (keys & ~previous_keys) | key_downs;
+    released_keys = (previous_keys & ~keys) | key_ups;
+    key_downs.reset();
+    key_ups.reset();
+
+    // mouse
+
+    previous_mouse_buttons = mouse_buttons;
+
+    if (replaying) {
+      mouse_buttons = event_mouse_buttons;
+      mouse_x = event_mouse_x;
+      mouse_y = event_mouse_y;
+    } else {
+      mouse_buttons = SDL_GetMouseState(&mouse_x, &mouse_y);
+    }
+
+    pressed_mouse_buttons = (mouse_buttons & ~previous_mouse_buttons) | mouse_button_downs;
+    released_mouse_buttons = (previous_mouse_buttons & ~mouse_buttons) | mouse_button_ups;
+    mouse_button_downs = mouse_button_ups = 0;
+
+    // gamepads, the devices of the recording are not there during a replay
+
+    if (!replaying) {
+      update_gamepads();
+    }
+
+    for (int slot = 0; slot < MaxGamepads; ++slot) {
+      auto & gamepad = gamepads[slot];
+      gamepad.previous_buttons = gamepad.buttons;
+      gamepad.buttons = 0;
+
+      if (gamepad.controller != nullptr) {
+        for (int button = 0; button < SDL_CONTROLLER_BUTTON_MAX; ++button) {
+          if (SDL_GameControllerGetButton(gamepad.controller, static_cast<SDL_GameControllerButton>(button)) != 0) {
+            gamepad.buttons |= UINT32_C(1) << button;
+          }
+        }
+
+        for (int axis = 0; axis < SDL_CONTROLLER_AXIS_MAX; ++axis) {
+          gamepad.axes[axis] = SDL_GameControllerGetAxis(gamepad.controller, static_cast<SDL_GameControllerAxis>(axis));
+        }
+      }
+
+      gamepad.pressed_buttons = (gamepad.buttons & ~gamepad.previous_buttons) | gamepad_button_downs[slot];
+      gamepad.released_buttons = (gamepad.previous_buttons & ~gamepad.buttons) | gamepad_button_ups[slot];
+      gamepad_button_downs[slot] = gamepad_button_ups[slot] = 0;
+    }
+  }
+
+  GamepadState *InputState::find_gamepad(SDL_JoystickID id) {
+    for (auto & gamepad : gamepads) {
+      if (gamepad.controller != nullptr && gamepad.id == id) {
+        return &gamepad;
+      }
+    }
+
+    return nullptr;
+  }
+
+  InputState& InputState::get() {
+    static InputState state;
+    return state;
+  }
+
+  void InputState::update_gamepads() {
+    // a disconnected gamepad frees its slot, the other players keep theirs
+
+    for (auto & gamepad : gamepads) {
+      if (gamepad.controller != nullptr && !SDL_GameControllerGetAttached(gamepad.controller)) {
+        SDL_GameControllerClose(gamepad.controller);
+        gamepad = GamepadState{};
+      }
+    }
+
+    const int count = SDL_NumJoysticks();
+
+    for (int index = 0; index < count; ++index) {
+      if (!SDL_IsGameController(index) || find_gamepad(SDL_JoystickGetDeviceInstanceID(index)) != nullptr) {
+        continue;
+      }
+
+      auto free_slot = std::find_if(std::begin(gamepads), std::end(gamepads), [](const GamepadState& gamepad) {
+        return gamepad.controller == nullptr;
+      });
+
+      if (free_slot == std::end(gamepads)) {
+        break;
+      }
+
+      if (SDL_GameController *controller = SDL_GameControllerOpen(index); controller != nullptr) {
+        *free_slot = GamepadState{};
+        free_slot->controller = controller;
+        free_slot->id = SDL_JoystickGetDeviceInstanceID(index);
+      }
+    }
+  }
+
+  struct InputApi : InputClass {
+
+    static void update(AgateVM *vm) {
+      if (!sdl_require(SDL_INIT_EVENTS | SDL_INIT_GAMECONTROLLER)) {
+        agateError(vm, "Unable to initialize events: %s", SDL_GetError());
+        return;
+      }
+
+      InputState::get().update();
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static bool get_scancode(AgateVM *vm, ptrdiff_t slot, std::size_t& scancode) {
+      int64_t value;
+
+      if (!agateCheck(vm, slot, value)) {
+        agateError(vm, "Int parameter expected for `scancode`.");
+        return false;
+      }
+
+      if (value < 0 || value >= SDL_NUM_SCANCODES) {
+        agateError(vm, "Invalid scancode.");
+        return false;
+      }
+
+      scancode = static_cast<std::size_t>(value);
+      return true;
+    }
+
+    static void generic_key(AgateVM *vm, const InputState::KeySet& keys) {
+      if (std::size_t scancode; get_scancode(vm, 1, scancode)) {
+        agateSlotSetBool(vm, AGATE_RETURN_SLOT, keys.test(scancode));
+      }
+    }
+
+    static void key_down(AgateVM *vm) {
+      generic_key(vm, InputState::get().keys);
+    }
+
+    static void key_pressed(AgateVM *vm) {
+      generic_key(vm, InputState::get().pressed_keys);
+    }
+
+    static void key_released(AgateVM *vm) {
+      generic_key(vm, InputState::get().released_keys);
+    }
+
+    static void generic_mouse_button(AgateVM *vm, uint32_t buttons) {
+      int64_t button;
+
+      if (!agateCheck(vm, 1, button)) {
+        agateError(vm, "Int parameter expected for `button`.");
+        return;
+      }
+
+      agateSlotSetBool(vm, AGATE_RETURN_SLOT, (buttons & compute_mouse_button_mask(button)) != 0);
+    }
+
+    static void mouse_button_down(AgateVM *vm) {
+      generic_mouse_button(vm, InputState::get().mouse_buttons);
+    }
 
-      switch (event->type) {
-        case SDL_WINDOWEVENT:
-          switch (event->window.event) {
-            case SDL_WINDOWEVENT_SIZE_CHANGED:
-              event_new_foreign(vm, "ResizeEvent", event);
-              return true;
-            case SDL_WINDOWEVENT_CLOSE:
-            case SDL_WINDOWEVENT_FOCUS_GAINED:
-            case SDL_WINDOWEVENT_FOCUS_LOST:
-            case SDL_WINDOWEVENT_ENTER:
-            case SDL_WINDOWEVENT_LEAVE:
-            case SDL_WINDOWEVENT_SHOWN:
-            case SDL_WINDOWEVENT_HIDDEN:
-            case SDL_WINDOWEVENT_EXPOSED:
-            case SDL_WINDOWEVENT_MINIMIZED:
-            case SDL_WINDOWEVENT_MAXIMIZED:
-            case SDL_WINDOWEVENT_RESTORED:
-              event_new_foreign(vm, "__GenericWindowEvent", event);
-              return true;
-            default:
-              return false;
+    static void mouse_button_pressed(AgateVM *vm) {
+      generic_mouse_button(vm, InputState::get().pressed_mouse_buttons);
+    }
+
+    static void mouse_button_released(AgateVM *vm) {
+      generic_mouse_button(vm, InputState::get().released_mouse_buttons);
+    }
+
+    static void mouse_coordinates(AgateVM *vm) {
+      auto & input = InputState::get();
+      auto coordinates = agateSlotNew<Vec2IClass>(vm, AGATE_RETURN_SLOT);
+      coordinates->x = input.mouse_x;
+      coordinates->y = input.mouse_y;
+    }
+
+    static const GamepadState *get_gamepad(AgateVM *vm) {
+      int64_t slot;
+
+      if (!agateCheck(vm, 1, slot)) {
+        agateError(vm, "Int parameter expected for `slot`.");
+        return nullptr;
+      }
+
+      if (slot < 0 || slot >= MaxGamepads) {
+        agateError(vm, "Invalid gamepad slot.");
+        return nullptr;
+      }
+
+      return &InputState::get().gamepads[slot];
+    }
+
+    static void gamepad_connected(AgateVM *vm) {
+      if (auto gamepad = get_gamepad(vm); gamepad != nullptr) {
+        agateSlotSetBool(vm, AGATE_RETURN_SLOT, gamepad->controller != nullptr);
+      }
+    }
+
+    static void gamepad_id(AgateVM *vm) {
+      auto gamepad = get_gamepad(vm);
+
+      if (gamepad == nullptr) {
+        return;
+      }
+
+      if (gamepad->controller == nullptr) {
+        agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, gamepad->id);
+    }
+
+    static void generic_gamepad_button(AgateVM *vm, uint32_t GamepadState::* buttons) {
+      auto gamepad = get_gamepad(vm);
+
+      if (gamepad == nullptr) {
+        return;
+      }
+
+      int64_t button;
+
+      if (!agateCheck(vm, 2, button)) {
+        agateError(vm, "Int parameter expected for `button`.");
+        return;
+      }
+
+      agateSlotSetBool(vm, AGATE_RETURN_SLOT, (gamepad->*buttons & compute_gamepad_button_mask(button)) != 0);
+    }
+
+    static void gamepad_button_down(AgateVM *vm) {
+      generic_gamepad_button(vm, &GamepadState::buttons);
+    }
+
+    static void gamepad_button_pressed(AgateVM *vm) {
+      generic_gamepad_button(vm, &GamepadState::pressed_buttons);
+    }
+
+    static void gamepad_button_released(AgateVM *vm) {
+      generic_gamepad_button(vm, &GamepadState::released_buttons);
+    }
+
+    static void gamepad_axis(AgateVM *vm) {
+      auto gamepad = get_gamepad(vm);
+
+      if (gamepad == nullptr) {
+        return;
+      }
+
+      int64_t axis;
+
+      if (!agateCheck(vm, 2, axis)) {
+        agateError(vm, "Int parameter expected for `axis`.");
+        return;
+      }
+
+      if (axis < 0 || axis >= SDL_CONTROLLER_AXIS_MAX) {
+        agateError(vm, "Invalid gamepad axis.");
+        return;
+      }
+
+      // the axes are in [-32768, 32767], the triggers in [0, 32767]
+      agateSlotSetFloat(vm, AGATE_RETURN_SLOT, std::max(gamepad->axes[axis] / 32767.0, -1.0));
+    }
+
+  };
+
+  /*
+   * ActionSet
+   */
+
+  void ActionTable::update(const InputState& input) {
+    // the transitions of the bound inputs, so that a press and a release in the same frame are not lost
+    uint64_t tapped = 0;
+    uint64_t let_go = 0;
+
+    previous = active;
+    active = 0;
+    std::fill(std::begin(values), std::end(values), 0.0f);
+
+    auto gamepad_selected = [this](int slot) {
+      return gamepad_slot < 0 || gamepad_slot == slot;
+    };
+
+    for (auto & binding : bindings) {
+      const uint64_t mask = UINT64_C(1) << binding.action;
+      float value = 0.0f;
+
+      switch (binding.type) {
+        case ActionBindingType::KEY:
+          if (input.keys.test(binding.code)) {
+            value = 1.0f;
+          }
+
+          if (input.pressed_keys.test(binding.code)) {
+            tapped |= mask;
+          }
+
+          if (input.released_keys.test(binding.code)) {
+            let_go |= mask;
+          }
+          break;
+
+        case ActionBindingType::MOUSE_BUTTON:
+          if ((input.mouse_buttons & compute_mouse_button_mask(binding.code)) != 0) {
+            value = 1.0f;
+          }
+
+          if ((input.pressed_mouse_buttons & compute_mouse_button_mask(binding.code)) != 0) {
+            tapped |= mask;
+          }
+
+          if ((input.released_mouse_buttons & compute_mouse_button_mask(binding.code)) != 0) {
+            let_go |= mask;
+          }
+          break;
+
+        case ActionBindingType::GAMEPAD_BUTTON:
+          for (int slot = 0; slot < MaxGamepads; ++slot) {
+            if (!gamepad_selected(slot)) {
+              continue;
+            }
+
+            auto & gamepad = input.gamepads[slot];
+
+            if ((gamepad.buttons & compute_gamepad_button_mask(binding.code)) != 0) {
+              value = 1.0f;
+            }
+
+            if ((gamepad.pressed_buttons & compute_gamepad_button_mask(binding.code)) != 0) {
+              tapped |= mask;
+            }
+
+            if ((gamepad.released_buttons & compute_gamepad_button_mask(binding.code)) != 0) {
+              let_go |= mask;
+            }
+          }
+          break;
+
+        case ActionBindingType::GAMEPAD_AXIS:
+          for (int slot = 0; slot < MaxGamepads; ++slot) {
+            auto & gamepad = input.gamepads[slot];
+
+            if (!gamepad_selected(slot) || gamepad.controller == nullptr) {
+              continue;
+            }
+
+            // rescale what is out of the deadzone in [0, 1]
+            const float axis = std::max(gamepad.axes[binding.code] / 32767.0f, -1.0f) * binding.direction;
+
+            if (axis > binding.deadzone) {
+              value = std::max(value, (axis - binding.deadzone) / (1.0f - binding.deadzone));
+            }
           }
           break;
-        case SDL_QUIT:
-          event_new_foreign(vm, "__GenericEvent", event);
-          return true;
-        case SDL_KEYDOWN:
-        case SDL_KEYUP:
-          event_new_foreign(vm, "KeyboardEvent", event);
-          return true;
-        case SDL_MOUSEWHEEL:
-          event_new_foreign(vm, "MouseWheelEvent", event);
-          return true;
-        case SDL_MOUSEBUTTONDOWN:
-        case SDL_MOUSEBUTTONUP:
-          event_new_foreign(vm, "MouseButtonEvent", event);
-          return true;
-        case SDL_MOUSEMOTION:
-          event_new_foreign(vm, "MouseMotionEvent", event);
-          return true;
-        case SDL_CONTROLLERDEVICEADDED:
-        case SDL_CONTROLLERDEVICEREMOVED:
-        case SDL_CONTROLLERBUTTONDOWN:
-        case SDL_CONTROLLERBUTTONUP:
-        case SDL_CONTROLLERAXISMOTION:
-        case SDL_TEXTINPUT:
-        case SDL_FINGERDOWN:
-        case SDL_FINGERMOTION:
-        case SDL_FINGERUP:
-          event_new_foreign(vm, "__GenericEvent", event);
-          return true;
-        default:
-          return false;
       }
 
-      return false;
+      if (value > 0.0f) {
+        active |= mask;
+        values[binding.action] = std::max(values[binding.action], value);
+      }
     }
 
-    // methods
+    // an action that was already active through another binding is not pressed again,
+    // and an action pressed and released in the same frame is reported both ways
+    pressed = (active | tapped) & ~previous;
+    released = (previous | (pressed & let_go)) & ~active;
+  }
 
-    static void poll(AgateVM *vm) {
-      SDL_Event event;
+  struct ActionSetApi : ActionSetClass {
 
-      do {
-        if (SDL_PollEvent(&event) == 0) {
-          agateSlotSetNil(vm, AGATE_RETURN_SLOT);
-          return;
-        }
-      } while (!event_new(vm, &event));
+    static void destroy(AgateVM *vm, const char *unit_name, const char *class_name, void *data) {
+      auto set = static_cast<ActionSet *>(data);
+      delete set->table;
+      set->table = nullptr;
     }
 
-    static void type(AgateVM *vm) {
-      assert(agateCheckTag<EventClass>(vm, 0));
-      auto event = agateSlotGet<EventClass>(vm, 0);
-      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(compute_event_kind(event)));
+    static void new0(AgateVM *vm) {
+      assert(agateCheckTag<ActionSetClass>(vm, 0));
+      auto set = agateSlotGet<ActionSetClass>(vm, 0);
+      set->table = new ActionTable;
     }
 
-    #define X(name)                 \
-    static void name(AgateVM *vm) { \
-      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(EventType::name)); \
+    static bool get_action(AgateVM *vm, const ActionTable *table, int& action) {
+      int64_t value;
+
+      if (!agateCheck(vm, 1, value)) {
+        agateError(vm, "Int parameter expected for `action`.");
+        return false;
+      }
+
+      if (value < 0 || value >= table->count) {
+        agateError(vm, "Unknown action.");
+        return false;
+      }
+
+      action = static_cast<int>(value);
+      return true;
     }
 
-    GAMMA_EVENT_TYPE_LIST
+    static void add_action(AgateVM *vm) {
+      assert(agateCheckTag<ActionSetClass>(vm, 0));
+      auto set = agateSlotGet<ActionSetClass>(vm, 0);
 
-    #undef X
+      if (set->table->count == MaxActions) {
+        agateError(vm, "Too many actions in the set.");
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, set->table->count++);
+    }
+
+    static void generic_bind(AgateVM *vm, ActionBindingType type, const char *name, int64_t min, int64_t max) {
+      assert(agateCheckTag<ActionSetClass>(vm, 0));
+      auto set = agateSlotGet<ActionSetClass>(vm, 0);
+
+      ActionBinding binding = {};
+      binding.type = type;
+
+      if (!get_action(vm, set->table, binding.action)) {
+        return;
+      }
+
+      int64_t code;
+
+      if (!agateCheck(vm, 2, code)) {
+        agateError(vm, "Int parameter expected for `%s`.", name);
+        return;
+      }
+
+      if (code < min || code >= max) {
+        agateError(vm, "Invalid `%s`.", name);
+        return;
+      }
+
+      binding.code = static_cast<int>(code);
+      set->table->bindings.push_back(binding);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void bind_key(AgateVM *vm) {
+      generic_bind(vm, ActionBindingType::KEY, "scancode", 0, SDL_NUM_SCANCODES);
+    }
+
+    static void bind_mouse_button(AgateVM *vm) {
+      generic_bind(vm, ActionBindingType::MOUSE_BUTTON, "button", 1, 33);
+    }
+
+    static void bind_gamepad_button(AgateVM *vm) {
+      generic_bind(vm, ActionBindingType::GAMEPAD_BUTTON, "button", 0, SDL_CONTROLLER_BUTTON_MAX);
+    }
+
+    static void bind_gamepad_axis(AgateVM *vm) {
+      assert(agateCheckTag<ActionSetClass>(vm, 0));
+      auto set = agateSlotGet<ActionSetClass>(vm, 0);
+
+      ActionBinding binding = {};
+      binding.type = ActionBindingType::GAMEPAD_AXIS;
+
+      if (!get_action(vm, set->table, binding.action)) {
+        return;
+      }
+
+      int64_t axis;
+
+      if (!agateCheck(vm, 2, axis)) {
+        agateError(vm, "Int parameter expected for `axis`.");
+        return;
+      }
+
+      if (axis < 0 || axis >= SDL_CONTROLLER_AXIS_MAX) {
+        agateError(vm, "Invalid `axis`.");
+        return;
+      }
+
+      int64_t direction;
+
+      if (!agateCheck(vm, 3, direction)) {
+        agateError(vm, "Int parameter expected for `direction`.");
+        return;
+      }
+
+      if (direction != 1 && direction != -1) {
+        agateError(vm, "Direction must be 1 or -1.");
+        return;
+      }
+
+      float deadzone;
+
+      if (!agateCheck(vm, 4, deadzone)) {
+        agateError(vm, "Float parameter expected for `deadzone`.");
+        return;
+      }
+
+      if (deadzone < 0.0f || deadzone >= 1.0f) {
+        agateError(vm, "Deadzone must be in [0, 1).");
+        return;
+      }
+
+      binding.code = static_cast<int>(axis);
+      binding.direction = static_cast<int>(direction);
+      binding.deadzone = deadzone;
+      set->table->bindings.push_back(binding);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void clear_bindings(AgateVM *vm) {
+      assert(agateCheckTag<ActionSetClass>(vm, 0));
+      auto set = agateSlotGet<ActionSetClass>(vm, 0);
+      set->table->bindings.clear();
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void gamepad_slot(AgateVM *vm) {
+      assert(agateCheckTag<ActionSetClass>(vm, 0));
+      auto set = agateSlotGet<ActionSetClass>(vm, 0);
+
+      if (set->table->gamepad_slot < 0) {
+        agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+        return;
+      }
+
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, set->table->gamepad_slot);
+    }
+
+    static void gamepad_slot_setter(AgateVM *vm) {
+      assert(agateCheckTag<ActionSetClass>(vm, 0));
+      auto set = agateSlotGet<ActionSetClass>(vm, 0);
+
+      if (agateSlotType(vm, 1) == AGATE_TYPE_NIL) {
+        set->table->gamepad_slot = -1;
+        agateSlotCopy(vm, AGATE_RETURN_SLOT, 1);
+        return;
+      }
+
+      int64_t slot;
+
+      if (!agateCheck(vm, 1, slot)) {
+        agateError(vm, "Int parameter expected for `value`.");
+        return;
+      }
+
+      if (slot < 0 || slot >= MaxGamepads) {
+        agateError(vm, "Invalid gamepad slot.");
+        return;
+      }
+
+      set->table->gamepad_slot = static_cast<int>(slot);
+      agateSlotCopy(vm, AGATE_RETURN_SLOT, 1);
+    }
+
+    static void update(AgateVM *vm) {
+      assert(agateCheckTag<ActionSetClass>(vm, 0));
+      auto set = agateSlotGet<ActionSetClass>(vm, 0);
+      set->table->update(InputState::get());
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void generic_state(AgateVM *vm, uint64_t ActionTable::* states) {
+      assert(agateCheckTag<ActionSetClass>(vm, 0));
+      auto set = agateSlotGet<ActionSetClass>(vm, 0);
+
+      if (int action; get_action(vm, set->table, action)) {
+        agateSlotSetBool(vm, AGATE_RETURN_SLOT, ((set->table->*states >> action) & 1) != 0);
+      }
+    }
+
+    static void active(AgateVM *vm) {
+      generic_state(vm, &ActionTable::active);
+    }
+
+    static void pressed(AgateVM *vm) {
+      generic_state(vm, &ActionTable::pressed);
+    }
+
+    static void released(AgateVM *vm) {
+      generic_state(vm, &ActionTable::released);
+    }
+
+    static void value(AgateVM *vm) {
+      assert(agateCheckTag<ActionSetClass>(vm, 0));
+      auto set = agateSlotGet<ActionSetClass>(vm, 0);
+
+      if (int action; get_action(vm, set->table, action)) {
+        agateSlotSetFloat(vm, AGATE_RETURN_SLOT, set->table->values[action]);
+      }
+    }
+
+    static void states(AgateVM *vm) {
+      assert(agateCheckTag<ActionSetClass>(vm, 0));
+      auto set = agateSlotGet<ActionSetClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(set->table->active));
+    }
 
   };
 
@@ -840,8 +2221,17 @@ namespace gma {
     support.add_class_handler(unit_name, "MouseWheelEvent", generic_simple_handler<MouseWheelEventClass>());
     support.add_class_handler(unit_name, "__GenericWindowEvent", generic_simple_handler<WindowEventClass>());
     support.add_class_handler(unit_name, "ResizeEvent", generic_simple_handler<ResizeEventClass>());
+    support.add_class_handler(unit_name, EventBufferApi::class_name, generic_simple_handler<EventBufferClass>());
+    support.add_class_handler(unit_name, ActionSetApi::class_name, generic_handler<ActionSetClass>(ActionSetApi::destroy));
 
     support.add_method(unit_name, EventApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "poll()", EventApi::poll);
+    support.add_method(unit_name, EventApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "poll_all()", EventApi::poll_all);
+    support.add_method(unit_name, EventApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "wait()", EventApi::wait0);
+    support.add_method(unit_name, EventApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "wait(_)", EventApi::wait1);
+    support.add_method(unit_name, EventApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "coalescing", EventApi::coalescing);
+    support.add_method(unit_name, EventApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "coalescing=(_)", EventApi::coalescing_setter);
+    support.add_method(unit_name, EventApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "axis_threshold", EventApi::axis_threshold);
+    support.add_method(unit_name, EventApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "axis_threshold=(_)", EventApi::axis_threshold_setter);
 
     #define X(name) support.add_method(unit_name, EventApi::class_name, AGATE_FOREIGN_METHOD_CLASS, #name, EventApi::name);
     GAMMA_EVENT_TYPE_LIST
@@ -873,6 +2263,57 @@ namespace gma {
 
     support.add_method(unit_name, ResizeEventApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "size", ResizeEventApi::size);
 
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "count", EventBufferApi::count);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "[_]", EventBufferApi::subscript_getter);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "type(_)", EventBufferApi::type);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "window_id(_)", EventBufferApi::window_id);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "pressed(_)", EventBufferApi::pressed);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "repeat(_)", EventBufferApi::repeat);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "scancode(_)", EventBufferApi::scancode);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "keycode(_)", EventBufferApi::keycode);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "modifiers(_)", EventBufferApi::modifiers);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "button(_)", EventBufferApi::button);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "clicks(_)", EventBufferApi::clicks);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "coordinates(_)", EventBufferApi::coordinates);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "motion(_)", EventBufferApi::motion);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "x(_)", EventBufferApi::x);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "y(_)", EventBufferApi::y);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "dx(_)", EventBufferApi::dx);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "dy(_)", EventBufferApi::dy);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "offset(_)", EventBufferApi::offset);
+    support.add_method(unit_name, EventBufferApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "size(_)", EventBufferApi::size);
+
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "update()", InputApi::update);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "key_down(_)", InputApi::key_down);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "key_pressed(_)", InputApi::key_pressed);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "key_released(_)", InputApi::key_released);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "mouse_button_down(_)", InputApi::mouse_button_down);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "mouse_button_pressed(_)", InputApi::mouse_button_pressed);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "mouse_button_released(_)", InputApi::mouse_button_released);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "mouse_coordinates", InputApi::mouse_coordinates);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "gamepad_connected(_)", InputApi::gamepad_connected);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "gamepad_id(_)", InputApi::gamepad_id);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "gamepad_button_down(_,_)", InputApi::gamepad_button_down);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "gamepad_button_pressed(_,_)", InputApi::gamepad_button_pressed);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "gamepad_button_released(_,_)", InputApi::gamepad_button_released);
+    support.add_method(unit_name, InputApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "gamepad_axis(_,_)", InputApi::gamepad_axis);
+
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new()", ActionSetApi::new0);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "add_action()", ActionSetApi::add_action);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "bind_key(_,_)", ActionSetApi::bind_key);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "bind_mouse_button(_,_)", ActionSetApi::bind_mouse_button);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "bind_gamepad_button(_,_)", ActionSetApi::bind_gamepad_button);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "bind_gamepad_axis(_,_,_,_)", ActionSetApi::bind_gamepad_axis);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "clear_bindings()", ActionSetApi::clear_bindings);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "gamepad_slot", ActionSetApi::gamepad_slot);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "gamepad_slot=(_)", ActionSetApi::gamepad_slot_setter);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "update()", ActionSetApi::update);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "active(_)", ActionSetApi::active);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "pressed(_)", ActionSetApi::pressed);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "released(_)", ActionSetApi::released);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "value(_)", ActionSetApi::value);
+    support.add_method(unit_name, ActionSetApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "states", ActionSetApi::states);
+
     #define X(name, code) support.add_method(unit_name, MouseApi::class_name, AGATE_FOREIGN_METHOD_CLASS, #name, MouseApi::name);
     GAMMA_MOUSE_BUTTON_LIST
     #undef X
@@ -1,6 +1,10 @@
 #ifndef GAMMA_EVENT_H
 #define GAMMA_EVENT_H
 
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
 #include <SDL2/SDL.h>
 
 #include "gamma_support.h"
@@ -60,6 +64,164 @@ namespace gma {
     static constexpr const char * class_name = "ResizeEvent";
   };
 
+  /*
+   * EventBuffer
+   */
+
+  // the events drained by Event.poll_all(), the storage is reused from frame to frame
+  struct EventQueue {
+    std::vector<SDL_Event> events;
+    uint64_t generation = 0;
+
+    void poll();
+
+    static EventQueue& get();
+  };
+
+  // a view on the queue as it was after a given poll
+  struct EventBuffer {
+    uint64_t generation;
+  };
+
+  struct EventBufferClass : EventUnit {
+    using type = EventBuffer;
+    static constexpr const char * class_name = "EventBuffer";
+    static constexpr uint64_t tag = compute_tag(unit_name, class_name);
+  };
+
+  /*
+   * Input
+   */
+
+  inline constexpr int MaxGamepads = 8;
+
+  struct GamepadState {
+    SDL_GameController *controller; // nullptr if the slot is free
+    SDL_JoystickID id;
+    uint32_t buttons;
+    uint32_t previous_buttons;
+    uint32_t pressed_buttons;
+    uint32_t released_buttons;
+    int16_t axes[SDL_CONTROLLER_AXIS_MAX];
+  };
+
+  // keyboard, mouse and gamepad state, refreshed once per frame
+  struct InputState {
+    using KeySet = std::bitset<SDL_NUM_SCANCODES>;
+
+    KeySet keys;
+    KeySet previous_keys;
+    KeySet pressed_keys;
+    KeySet released_keys;
+
+    uint32_t mouse_buttons = 0;
+    uint32_t previous_mouse_buttons = 0;
+    uint32_t pressed_mouse_buttons = 0;
+    uint32_t released_mouse_buttons = 0;
+    int mouse_x = 0;
+    int mouse_y = 0;
+
+    GamepadState gamepads[MaxGamepads] = {};
+
+    // the transitions seen in the events since the last update, so that a press and a release in the same frame are not lost
+    KeySet key_downs;
+    KeySet key_ups;
+    uint32_t mouse_button_downs = 0;
+    uint32_t mouse_button_ups = 0;
+    uint32_t gamepad_button_downs[MaxGamepads] = {};
+    uint32_t gamepad_button_ups[MaxGamepads] = {};
+
+    // the event queue has been emptied since the last update, so the state of SDL matches the processed events
+    bool events_drained = false;
+
+    // the state that the events describe, used instead of the devices during a replay
+    KeySet event_keys;
+    uint32_t event_mouse_buttons = 0;
+    int event_mouse_x = 0;
+    int event_mouse_y = 0;
+
+    void process(const SDL_Event& event);
+    void update();
+
+    GamepadState *find_gamepad(SDL_JoystickID id);
+
+    static InputState& get();
+
+  private:
+    void update_gamepads();
+  };
+
+  // opt-in merging of the motion events, so that high rate mice and analog sticks do not flood the scripts
+  struct EventCoalescer {
+    struct AxisValues {
+      SDL_JoystickID which;
+      int16_t values[SDL_CONTROLLER_AXIS_MAX];
+    };
+
+    bool enabled = false;
+    int axis_threshold = 0; // in the units of SDL, axis events closer than this to the last kept value are dropped
+    std::vector<AxisValues> last_axis_values;
+
+    // merge `next` into `event` if both are consecutive motions of the same device
+    bool merge(SDL_Event& event, const SDL_Event& next) const;
+    // check the axis threshold, and remember the value of the kept axis events
+    bool keep(const SDL_Event& event);
+
+    static EventCoalescer& get();
+  };
+
+  struct InputClass : EventUnit {
+    // no type
+    static constexpr const char * class_name = "Input";
+    static constexpr uint64_t tag = compute_tag(unit_name, class_name);
+  };
+
+  /*
+   * ActionSet
+   */
+
+  inline constexpr int MaxActions = 64;
+
+  enum class ActionBindingType {
+    KEY,
+    MOUSE_BUTTON,
+    GAMEPAD_BUTTON,
+    GAMEPAD_AXIS,
+  };
+
+  struct ActionBinding {
+    ActionBindingType type;
+    int action;
+    int code;       // scancode, mouse button, gamepad button or gamepad axis
+    int direction;  // 1 or -1 for an axis
+    float deadzone; // in [0, 1) for an axis
+  };
+
+  // the actions are evaluated against the input state, each frame gives a bitset of their states
+  struct ActionTable {
+    std::vector<ActionBinding> bindings;
+    int count = 0;
+    int gamepad_slot = -1; // -1 for any gamepad
+
+    uint64_t active = 0;
+    uint64_t previous = 0;
+    uint64_t pressed = 0;
+    uint64_t released = 0;
+    float values[MaxActions] = {};
+
+    void update(const InputState& input);
+  };
+
+  struct ActionSet {
+    ActionTable *table;
+  };
+
+  struct ActionSetClass : EventUnit {
+    using type = ActionSet;
+    static constexpr const char * class_name = "ActionSet";
+    static constexpr uint64_t tag = compute_tag(unit_name, class_name);
+  };
+
   struct MouseClass : EventUnit {
     // no type
     static constexpr const char * class_name = "Mouse";
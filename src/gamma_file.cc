@@ -0,0 +1,317 @@
+#include "gamma_file.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "gamma_agate.h"
+
+namespace gma {
+
+  /*
+   * FileMapping
+   */
+
+#ifdef _WIN32
+
+  FileMapping::FileMapping(const char *filename) {
+    if (PackFile packed; find_in_packs(filename, packed)) {
+      data = packed.data;
+      size = packed.size;
+      return;
+    }
+
+    // the names are UTF-8 on every platform
+    const int length = MultiByteToWideChar(CP_UTF8, 0, filename, -1, nullptr, 0);
+
+    if (length == 0) {
+      return;
+    }
+
+    std::wstring wide_filename(length, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, filename, -1, wide_filename.data(), length);
+
+    file = CreateFileW(wide_filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE) {
+      file = nullptr;
+      return;
+    }
+
+    LARGE_INTEGER file_size;
+
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+      destroy();
+      return;
+    }
+
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (mapping == nullptr) {
+      destroy();
+      return;
+    }
+
+    data = static_cast<const uint8_t *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+
+    if (data == nullptr) {
+      destroy();
+      return;
+    }
+
+    size = static_cast<std::size_t>(file_size.QuadPart);
+    mapped = true;
+  }
+
+  void FileMapping::destroy() {
+    if (data != nullptr) {
+      if (mapped) {
+        UnmapViewOfFile(data);
+      }
+
+      data = nullptr;
+    }
+
+    if (mapping != nullptr) {
+      CloseHandle(mapping);
+      mapping = nullptr;
+    }
+
+    if (file != nullptr) {
+      CloseHandle(file);
+      file = nullptr;
+    }
+
+    size = 0;
+  }
+
+#else
+
+  FileMapping::FileMapping(const char *filename) {
+    if (PackFile packed; find_in_packs(filename, packed)) {
+      data = packed.data;
+      size = packed.size;
+      return;
+    }
+
+    int fd = open(filename, O_RDONLY);
+
+    if (fd == -1) {
+      return;
+    }
+
+    struct stat info;
+
+    if (fstat(fd, &info) == -1 || info.st_size == 0) {
+      close(fd);
+      return;
+    }
+
+    void *ptr = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping keeps a reference to the file
+
+    if (ptr == MAP_FAILED) {
+      return;
+    }
+
+    data = static_cast<const uint8_t *>(ptr);
+    size = static_cast<std::size_t>(info.st_size);
+    mapped = true;
+  }
+
+  void FileMapping::destroy() {
+    if (data != nullptr) {
+      if (mapped) {
+        munmap(const_cast<uint8_t *>(data), size);
+      }
+
+      data = nullptr;
+    }
+
+    size = 0;
+  }
+
+#endif
+
+  /*
+   * Pack
+   */
+
+  Pack::Pack(const char *filename)
+  : file(filename)
+  {
+    if (!file.loaded() || file.size < sizeof(PackHeader)) {
+      destroy();
+      return;
+    }
+
+    PackHeader header;
+    std::memcpy(&header, file.data, sizeof header);
+
+    if (std::memcmp(header.magic, PackMagic, sizeof PackMagic) != 0 || header.version != PackVersion) {
+      destroy();
+      return;
+    }
+
+    if (header.count > (file.size - sizeof(PackHeader)) / sizeof(PackEntry)) {
+      destroy();
+      return;
+    }
+
+    auto pack_entries = reinterpret_cast<const PackEntry *>(file.data + sizeof(PackHeader));
+
+    // check the bounds once, so that find() does not have to
+    for (uint32_t i = 0; i < header.count; ++i) {
+      const PackEntry& entry = pack_entries[i];
+
+      if (entry.name_offset > file.size || entry.name_size > file.size - entry.name_offset || entry.data_offset > file.size || entry.data_size >= file.size - entry.data_offset) {
+        destroy();
+        return;
+      }
+    }
+
+    entries = pack_entries;
+    count = header.count;
+  }
+
+  void Pack::destroy() {
+    file.destroy();
+    entries = nullptr;
+    count = 0;
+  }
+
+  bool Pack::find(std::string_view name, PackFile& result) const {
+    auto get_name = [this](const PackEntry& entry) {
+      return std::string_view(reinterpret_cast<const char *>(file.data + entry.name_offset), entry.name_size);
+    };
+
+    const PackEntry *end = entries + count;
+    const PackEntry *entry = std::lower_bound(entries, end, name, [&](const PackEntry& lhs, std::string_view rhs) {
+      return get_name(lhs) < rhs;
+    });
+
+    if (entry == end || get_name(*entry) != name) {
+      return false;
+    }
+
+    result.data = file.data + entry->data_offset;
+    result.size = static_cast<std::size_t>(entry->data_size);
+    return true;
+  }
+
+  static std::vector<Pack> mounted_packs;
+  static std::filesystem::path pack_directory;
+
+  bool mount_pack(const char *filename) {
+    Pack pack(filename);
+
+    if (!pack.loaded()) {
+      return false;
+    }
+
+    mounted_packs.push_back(pack);
+    return true;
+  }
+
+  void unmount_packs() {
+    for (auto & pack : mounted_packs) {
+      pack.destroy();
+    }
+
+    mounted_packs.clear();
+  }
+
+  bool find_in_packs(std::string_view name, PackFile& result) {
+    if (mounted_packs.empty()) {
+      return false;
+    }
+
+    std::filesystem::path path(name);
+
+    if (path.is_relative()) {
+      path = pack_directory / path;
+    }
+
+    // the names in the pack are normalized with forward slashes
+    std::string normalized = path.lexically_normal().generic_string();
+
+    for (auto iterator = mounted_packs.rbegin(); iterator != mounted_packs.rend(); ++iterator) {
+      if (iterator->find(normalized, result)) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  void set_pack_directory(std::string_view directory) {
+    pack_directory = std::filesystem::path(directory);
+  }
+
+  /*
+   * File
+   */
+
+  struct FileApi : FileClass {
+
+    static void read(AgateVM *vm) {
+      const char *filename = nullptr;
+
+      if (!agateCheck(vm, 1, filename)) {
+        agateError(vm, "String parameter expected for `filename`.");
+        return;
+      }
+
+      FileMapping file(filename);
+
+      if (!file.loaded()) {
+        agateError(vm, "Unable to read file: '%s'.", filename);
+        return;
+      }
+
+      agateSlotSetStringSize(vm, AGATE_RETURN_SLOT, reinterpret_cast<const char *>(file.data), static_cast<ptrdiff_t>(file.size));
+      file.destroy();
+    }
+
+    static void exists(AgateVM *vm) {
+      const char *filename = nullptr;
+
+      if (!agateCheck(vm, 1, filename)) {
+        agateError(vm, "String parameter expected for `filename`.");
+        return;
+      }
+
+      if (PackFile packed; find_in_packs(filename, packed)) {
+        agateSlotSetBool(vm, AGATE_RETURN_SLOT, true);
+        return;
+      }
+
+      std::error_code error;
+      agateSlotSetBool(vm, AGATE_RETURN_SLOT, std::filesystem::is_regular_file(filename, error));
+    }
+
+  };
+
+  /*
+   * FileUnit
+   */
+
+  void FileUnit::provide_support(Support & support) {
+    support.add_method(unit_name, FileApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "read(_)", FileApi::read);
+    support.add_method(unit_name, FileApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "exists(_)", FileApi::exists);
+  }
+
+}
@@ -0,0 +1,87 @@
+#ifndef GAMMA_FILE_H
+#define GAMMA_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "gamma_pack.h"
+#include "gamma_support.h"
+
+namespace gma {
+
+  struct FileUnit {
+    static constexpr const char * unit_name = "gamma/file";
+    static void provide_support(Support & support);
+  };
+
+  /*
+   * File
+   */
+
+  struct FileClass : FileUnit {
+    // no type
+    static constexpr const char * class_name = "File";
+    static constexpr uint64_t tag = compute_tag(unit_name, class_name);
+  };
+
+  /*
+   * FileMapping
+   */
+
+  // a file mapped in memory, or a file of a mounted pack
+  struct FileMapping {
+    const uint8_t *data = nullptr;
+    std::size_t size = 0;
+    bool mapped = false; // false for the files of a pack, that stay mapped with the pack
+#ifdef _WIN32
+    void *file = nullptr;
+    void *mapping = nullptr;
+#endif
+
+    FileMapping() = default;
+    FileMapping(const char *filename);
+    void destroy();
+
+    bool loaded() const {
+      return data != nullptr;
+    }
+  };
+
+  /*
+   * Pack
+   */
+
+  struct PackFile {
+    const uint8_t *data;
+    std::size_t size;
+  };
+
+  struct Pack {
+    FileMapping file;
+    const PackEntry *entries = nullptr;
+    uint32_t count = 0;
+
+    Pack() = default;
+    Pack(const char *filename);
+    void destroy();
+
+    bool loaded() const {
+      return file.loaded() && entries != nullptr;
+    }
+
+    // binary search in the index, `name` is relative to the root of the pack
+    bool find(std::string_view name, PackFile& result) const;
+  };
+
+  // mounted packs are searched before the file system by the loaders, the last mounted pack first
+  bool mount_pack(const char *filename);
+  void unmount_packs();
+  bool find_in_packs(std::string_view name, PackFile& result);
+
+  // relative names are searched in the packs from this directory, like they are searched on disk from the directory of the main unit
+  void set_pack_directory(std::string_view directory);
+
+}
+
+#endif // GAMMA_FILE_H
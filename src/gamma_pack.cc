@@ -0,0 +1,143 @@
+/* gamma, GAMes Made with Agate
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022 Julien Bernard
+ */
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gamma_pack.h"
+
+// packs all the files of a directory, the names in the pack are relative to the directory
+
+static void usage(void) {
+  std::printf("Usage: gamma-pack <pack> <directory>\n");
+}
+
+struct PackedFile {
+  std::filesystem::path path;
+  std::string name;
+  uint64_t size;
+};
+
+static uint64_t align(uint64_t offset) {
+  return (offset + gma::PackAlignment - 1) / gma::PackAlignment * gma::PackAlignment;
+}
+
+static bool write_padding(std::ofstream& output, uint64_t offset) {
+  static const char zeros[gma::PackAlignment] = { 0 };
+  const uint64_t current = static_cast<uint64_t>(output.tellp());
+  assert(current <= offset);
+  output.write(zeros, static_cast<std::streamsize>(offset - current));
+  return static_cast<bool>(output);
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    usage();
+    return EXIT_FAILURE;
+  }
+
+  std::filesystem::path root(argv[2]);
+  std::error_code error;
+
+  if (!std::filesystem::is_directory(root, error)) {
+    std::fprintf(stderr, "Not a directory: '%s'.\n", argv[2]);
+    return EXIT_FAILURE;
+  }
+
+  // collect the files
+
+  std::vector<PackedFile> files;
+
+  for (auto & item : std::filesystem::recursive_directory_iterator(root)) {
+    if (!item.is_regular_file()) {
+      continue;
+    }
+
+    PackedFile file;
+    file.path = item.path();
+    file.name = item.path().lexically_relative(root).lexically_normal().generic_string();
+    file.size = static_cast<uint64_t>(item.file_size());
+    files.push_back(std::move(file));
+  }
+
+  // the index is searched by name
+  std::sort(files.begin(), files.end(), [](const PackedFile& lhs, const PackedFile& rhs) {
+    return lhs.name < rhs.name;
+  });
+
+  // compute the layout
+
+  gma::PackHeader header;
+  std::memcpy(header.magic, gma::PackMagic, sizeof header.magic);
+  header.version = gma::PackVersion;
+  header.count = static_cast<uint32_t>(files.size());
+  header.reserved = 0;
+
+  std::vector<gma::PackEntry> entries(files.size());
+  uint64_t offset = sizeof(gma::PackHeader) + files.size() * sizeof(gma::PackEntry);
+
+  for (std::size_t i = 0; i < files.size(); ++i) {
+    entries[i].name_offset = offset;
+    entries[i].name_size = static_cast<uint32_t>(files[i].name.size());
+    entries[i].reserved = 0;
+    offset += files[i].name.size();
+  }
+
+  for (std::size_t i = 0; i < files.size(); ++i) {
+    offset = align(offset);
+    entries[i].data_offset = offset;
+    entries[i].data_size = files[i].size;
+    offset += files[i].size + 1; // null character
+  }
+
+  // write the pack
+
+  std::ofstream output(argv[1], std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if (!output) {
+    std::fprintf(stderr, "Unable to open pack: '%s'.\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  output.write(reinterpret_cast<const char *>(&header), sizeof header);
+  output.write(reinterpret_cast<const char *>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(gma::PackEntry)));
+
+  for (auto & file : files) {
+    output.write(file.name.data(), static_cast<std::streamsize>(file.name.size()));
+  }
+
+  std::vector<char> buffer;
+
+  for (std::size_t i = 0; i < files.size(); ++i) {
+    if (!write_padding(output, entries[i].data_offset)) {
+      break;
+    }
+
+    std::ifstream input(files[i].path, std::ios::in | std::ios::binary);
+    buffer.resize(files[i].size + 1);
+
+    if (!input.read(buffer.data(), static_cast<std::streamsize>(files[i].size))) {
+      std::fprintf(stderr, "Unable to read file: '%s'.\n", files[i].path.string().c_str());
+      return EXIT_FAILURE;
+    }
+
+    buffer.back() = '\0';
+    output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  }
+
+  if (!output.flush()) {
+    std::fprintf(stderr, "Unable to write pack: '%s'.\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  std::printf("%zu files packed in '%s'.\n", files.size(), argv[1]);
+  return EXIT_SUCCESS;
+}
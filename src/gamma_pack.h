@@ -0,0 +1,39 @@
+#ifndef GAMMA_PACK_H
+#define GAMMA_PACK_H
+
+#include <cstddef>
+#include <cstdint>
+
+// the pack layout is shared with gamma-pack, that does not depend on Agate
+
+namespace gma {
+
+  // pack file layout, little endian:
+  // - a header
+  // - the entries, sorted by name
+  // - the names
+  // - the data of the files, aligned on PackAlignment and followed by a null character (not counted in the size)
+  inline constexpr char PackMagic[4] = { 'G', 'P', 'A', 'K' };
+  inline constexpr uint32_t PackVersion = 1;
+  inline constexpr std::size_t PackAlignment = 16;
+
+  struct PackHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t count;
+    uint32_t reserved;
+  };
+
+  struct PackEntry {
+    uint64_t name_offset;
+    uint64_t data_offset;
+    uint64_t data_size;
+    uint32_t name_size;
+    uint32_t reserved;
+  };
+
+  static_assert(sizeof(PackHeader) == 16 && sizeof(PackEntry) == 32, "unexpected padding in the pack layout");
+
+}
+
+#endif // GAMMA_PACK_H
@@ -0,0 +1,239 @@
+#include "gamma_qoi.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+
+namespace gma {
+
+  namespace {
+
+    constexpr uint8_t QoiOpIndex  = 0x00;
+    constexpr uint8_t QoiOpDiff   = 0x40;
+    constexpr uint8_t QoiOpLuma   = 0x80;
+    constexpr uint8_t QoiOpRun    = 0xC0;
+    constexpr uint8_t QoiOpRgb    = 0xFE;
+    constexpr uint8_t QoiOpRgba   = 0xFF;
+    constexpr uint8_t QoiMask     = 0xC0;
+
+    constexpr uint8_t QoiMagic[4] = { 'q', 'o', 'i', 'f' };
+    constexpr uint8_t QoiPadding[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+    // same limit as the reference implementation, so that sizes never overflow
+    constexpr uint64_t QoiPixelsMax = 400000000;
+
+    struct QoiPixel {
+      uint8_t r, g, b, a;
+
+      bool operator==(const QoiPixel& other) const {
+        return r == other.r && g == other.g && b == other.b && a == other.a;
+      }
+    };
+
+    int qoi_hash(QoiPixel px) {
+      return (px.r * 3 + px.g * 5 + px.b * 7 + px.a * 11) % 64;
+    }
+
+    uint32_t qoi_read_32(const uint8_t *data) {
+      return (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) | (uint32_t(data[2]) << 8) | uint32_t(data[3]);
+    }
+
+    void qoi_write_32(std::vector<uint8_t>& bytes, uint32_t value) {
+      bytes.push_back(static_cast<uint8_t>(value >> 24));
+      bytes.push_back(static_cast<uint8_t>(value >> 16));
+      bytes.push_back(static_cast<uint8_t>(value >> 8));
+      bytes.push_back(static_cast<uint8_t>(value));
+    }
+
+  }
+
+  bool qoi_check_magic(const uint8_t *data, std::size_t size) {
+    return size >= QoiHeaderSize && std::memcmp(data, QoiMagic, sizeof QoiMagic) == 0;
+  }
+
+  bool qoi_read_size(const uint8_t *data, std::size_t size, int& width, int& height) {
+    if (!qoi_check_magic(data, size)) {
+      return false;
+    }
+
+    const uint32_t w = qoi_read_32(data + 4);
+    const uint32_t h = qoi_read_32(data + 8);
+
+    if (w == 0 || h == 0 || h >= QoiPixelsMax / w) {
+      return false;
+    }
+
+    width = static_cast<int>(w);
+    height = static_cast<int>(h);
+    return true;
+  }
+
+  uint8_t *qoi_decode(const uint8_t *data, std::size_t size, int& width, int& height) {
+    if (size < QoiHeaderSize + sizeof QoiPadding || !qoi_check_magic(data, size)) {
+      return nullptr;
+    }
+
+    const uint32_t w = qoi_read_32(data + 4);
+    const uint32_t h = qoi_read_32(data + 8);
+    const uint8_t channels = data[12];
+    const uint8_t colorspace = data[13];
+
+    if (w == 0 || h == 0 || channels < 3 || channels > 4 || colorspace > 1 || h >= QoiPixelsMax / w) {
+      return nullptr;
+    }
+
+    const std::size_t stride = std::size_t(w) * 4;
+    auto pixels = static_cast<uint8_t *>(std::malloc(stride * h));
+
+    if (pixels == nullptr) {
+      return nullptr;
+    }
+
+    QoiPixel index[64];
+    std::memset(index, 0, sizeof index);
+
+    QoiPixel px = { 0, 0, 0, 255 };
+    int run = 0;
+
+    // the padding guarantees that a chunk never reads past the end of the data
+    const std::size_t chunks_end = size - sizeof QoiPadding;
+    std::size_t p = QoiHeaderSize;
+
+    for (uint32_t y = 0; y < h; ++y) {
+      uint8_t *row = pixels + (h - y - 1) * stride;
+
+      for (uint32_t x = 0; x < w; ++x) {
+        if (run > 0) {
+          --run;
+        } else if (p < chunks_end) {
+          const uint8_t b1 = data[p++];
+
+          if (b1 == QoiOpRgb) {
+            px.r = data[p++];
+            px.g = data[p++];
+            px.b = data[p++];
+          } else if (b1 == QoiOpRgba) {
+            px.r = data[p++];
+            px.g = data[p++];
+            px.b = data[p++];
+            px.a = data[p++];
+          } else if ((b1 & QoiMask) == QoiOpIndex) {
+            px = index[b1];
+          } else if ((b1 & QoiMask) == QoiOpDiff) {
+            px.r += ((b1 >> 4) & 0x03) - 2;
+            px.g += ((b1 >> 2) & 0x03) - 2;
+            px.b += ( b1       & 0x03) - 2;
+          } else if ((b1 & QoiMask) == QoiOpLuma) {
+            const uint8_t b2 = data[p++];
+            const int vg = (b1 & 0x3F) - 32;
+            px.r += vg - 8 + ((b2 >> 4) & 0x0F);
+            px.g += vg;
+            px.b += vg - 8 +  (b2       & 0x0F);
+          } else if ((b1 & QoiMask) == QoiOpRun) {
+            run = (b1 & 0x3F);
+          }
+
+          index[qoi_hash(px)] = px;
+        }
+
+        std::memcpy(row + x * 4, &px, 4);
+      }
+    }
+
+    width = static_cast<int>(w);
+    height = static_cast<int>(h);
+    return pixels;
+  }
+
+  std::vector<uint8_t> qoi_encode(const uint8_t *pixels, int width, int height) {
+    std::vector<uint8_t> bytes;
+
+    if (width <= 0 || height <= 0 || uint64_t(width) * uint64_t(height) >= QoiPixelsMax) {
+      return bytes;
+    }
+
+    // worst case is one RGBA chunk per pixel
+    bytes.reserve(QoiHeaderSize + std::size_t(width) * height * 5 + sizeof QoiPadding);
+
+    bytes.insert(bytes.end(), std::begin(QoiMagic), std::end(QoiMagic));
+    qoi_write_32(bytes, static_cast<uint32_t>(width));
+    qoi_write_32(bytes, static_cast<uint32_t>(height));
+    bytes.push_back(4); // channels
+    bytes.push_back(0); // sRGB with linear alpha
+
+    QoiPixel index[64];
+    std::memset(index, 0, sizeof index);
+
+    QoiPixel prev = { 0, 0, 0, 255 };
+    int run = 0;
+
+    const std::size_t stride = std::size_t(width) * 4;
+    const std::size_t count = std::size_t(width) * height;
+    std::size_t i = 0;
+
+    for (int y = 0; y < height; ++y) {
+      const uint8_t *row = pixels + (height - y - 1) * stride;
+
+      for (int x = 0; x < width; ++x, ++i) {
+        QoiPixel px;
+        std::memcpy(&px, row + x * 4, 4);
+
+        if (px == prev) {
+          ++run;
+
+          if (run == 62 || i + 1 == count) {
+            bytes.push_back(QoiOpRun | (run - 1));
+            run = 0;
+          }
+
+          continue;
+        }
+
+        if (run > 0) {
+          bytes.push_back(QoiOpRun | (run - 1));
+          run = 0;
+        }
+
+        const int hash = qoi_hash(px);
+
+        if (index[hash] == px) {
+          bytes.push_back(QoiOpIndex | hash);
+        } else {
+          index[hash] = px;
+
+          if (px.a == prev.a) {
+            const int8_t vr = static_cast<int8_t>(px.r - prev.r);
+            const int8_t vg = static_cast<int8_t>(px.g - prev.g);
+            const int8_t vb = static_cast<int8_t>(px.b - prev.b);
+            const int8_t vg_r = static_cast<int8_t>(vr - vg);
+            const int8_t vg_b = static_cast<int8_t>(vb - vg);
+
+            if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+              bytes.push_back(QoiOpDiff | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));
+            } else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8) {
+              bytes.push_back(QoiOpLuma | (vg + 32));
+              bytes.push_back((vg_r + 8) << 4 | (vg_b + 8));
+            } else {
+              bytes.push_back(QoiOpRgb);
+              bytes.push_back(px.r);
+              bytes.push_back(px.g);
+              bytes.push_back(px.b);
+            }
+          } else {
+            bytes.push_back(QoiOpRgba);
+            bytes.push_back(px.r);
+            bytes.push_back(px.g);
+            bytes.push_back(px.b);
+            bytes.push_back(px.a);
+          }
+        }
+
+        prev = px;
+      }
+    }
+
+    bytes.insert(bytes.end(), std::begin(QoiPadding), std::end(QoiPadding));
+    return bytes;
+  }
+
+}
@@ -0,0 +1,29 @@
+#ifndef GAMMA_QOI_H
+#define GAMMA_QOI_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace gma {
+
+  /*
+   * QOI, the Quite OK Image format
+   */
+
+  inline constexpr std::size_t QoiHeaderSize = 14;
+
+  bool qoi_check_magic(const uint8_t *data, std::size_t size);
+
+  // read the size in the header, without decoding the pixels
+  bool qoi_read_size(const uint8_t *data, std::size_t size, int& width, int& height);
+
+  // decode RGBA pixels with rows stored bottom up like Image, the result is allocated with malloc
+  uint8_t *qoi_decode(const uint8_t *data, std::size_t size, int& width, int& height);
+
+  // encode RGBA pixels with rows stored bottom up like Image
+  std::vector<uint8_t> qoi_encode(const uint8_t *pixels, int width, int height);
+
+}
+
+#endif // GAMMA_QOI_H
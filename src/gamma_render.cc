@@ -1,13 +1,22 @@
 #include "gamma_render.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
 
 #include "gamma_agate.h"
 #include "gamma_debug.h"
+#include "gamma_replay.h"
+#include "gamma_sdl.h"
 #include "gamma_sprite.h"
 #include "gamma_text.h"
+#include "gamma_thread.h"
+#include "gamma_time.h"
 
 #include "shaders/default.vert.h"
 #include "shaders/default.frag.h"
@@ -625,7 +634,12 @@ namespace gma {
    * Renderer
    */
 
+  // a 1024x1024 RGBA texture
+  static constexpr std::size_t DefaultUploadBudget = 4 * 1024 * 1024;
+
   Renderer::Renderer(AgateVM *vm, Window *window) {
+    StartupPhase context_phase("context");
+
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
@@ -654,8 +668,11 @@ namespace gma {
     GAMMA_GL_CHECK(glGenVertexArrays(1, &vao));
     GAMMA_GL_CHECK(glBindVertexArray(vao));
 
-    default_shader = shader_compile_program(gamma_default_vert, gamma_default_frag);
-    default_alpha_shader = shader_compile_program(gamma_default_vert, gamma_default_alpha_frag);
+    {
+      StartupPhase shader_phase("shaders");
+      default_shader = shader_compile_program(gamma_default_vert, gamma_default_frag);
+      default_alpha_shader = shader_compile_program(gamma_default_vert, gamma_default_alpha_frag);
+    }
 
     const uint8_t pixel[] = { 0xFF, 0xFF, 0xFF, 0xFF };
 
@@ -672,6 +689,14 @@ namespace gma {
 
     camera = Camera(CameraType::SCREEN, vec(0.0f, 0.0f), vec(1.0f, 1.0f));
     camera.update(framebuffer_size);
+
+    upload_budget = DefaultUploadBudget;
+
+    frame_rate = 0;
+    frame_deadline = 0;
+    missed_frames = 0;
+    last_sleep = 0;
+    window_target = true;
   }
 
   void Renderer::destroy() {
@@ -682,6 +707,7 @@ namespace gma {
     GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
 
     if (default_texture != 0) {
+      TextureManager::get().remove(default_texture);
       GAMMA_GL_CHECK(glDeleteTextures(1, &default_texture));
       default_texture = 0;
     }
@@ -698,6 +724,9 @@ namespace gma {
       default_shader = 0;
     }
 
+    PixelUploader::get().destroy();
+    cancel_readbacks();
+
     GAMMA_GL_CHECK(glBindVertexArray(0));
     GAMMA_GL_CHECK(glDeleteVertexArrays(1, &vao));
     vao = 0;
@@ -706,6 +735,42 @@ namespace gma {
     context = nullptr;
   }
 
+  void Renderer::display() {
+    last_sleep = 0;
+
+    // only the frames of the window are paced, a texture target is part of the next frame of the window
+    if (frame_rate > 0 && window_target) {
+      const int64_t frame_time = INT64_C(1000000000) / frame_rate;
+      const int64_t now = time_now();
+
+      if (frame_deadline != 0 && now <= frame_deadline) {
+        time_sleep_until(frame_deadline);
+        last_sleep = time_now() - now;
+        frame_deadline += frame_time;
+      } else {
+        // a late frame restarts the schedule instead of rushing the next frames
+        if (frame_deadline != 0) {
+          ++missed_frames;
+        }
+
+        frame_deadline = now + frame_time;
+      }
+    }
+
+    SDL_GL_SwapWindow(SDL_GL_GetCurrentWindow());
+    StartupProfile::get().finish();
+    Replay::get().end_frame();
+
+    process_texture_uploads(upload_budget);
+    process_readbacks();
+    TextureManager::get().update();
+
+    // the uploads and readbacks that span several frames continue even if the next frame waits for events
+    if (has_pending_texture_uploads() || has_pending_readbacks()) {
+      sdl_wake();
+    }
+  }
+
   void Renderer::draw(const RendererData& submitted_data) {
     if (submitted_data.vertex_buffer == 0) {
       return;
@@ -715,6 +780,10 @@ namespace gma {
 
     // textures
 
+    TextureManager& textures = TextureManager::get();
+    textures.touch(data.texture0);
+    textures.touch(data.texture1);
+
     if (data.texture0 == 0) {
       data.texture0 = default_texture;
     }
@@ -867,6 +936,227 @@ namespace gma {
   }
 
 
+  /*
+   * Capture
+   */
+
+  enum class ReadbackStatus {
+    PENDING,  // waiting for the GPU
+    ENCODING, // waiting for the PNG encoder
+    READY,
+    FAILED,
+  };
+
+  struct Readback {
+    GLuint buffer = 0;
+    GLsync fence = nullptr;
+    Vec2I size = { 0, 0 };
+    std::string filename; // encoded to a PNG file if not empty
+
+    std::atomic<int> references = 1;
+    std::atomic<ReadbackStatus> status = ReadbackStatus::PENDING;
+    Image image = Image();
+
+    static Readback *start(GLuint framebuffer, Vec2I size, const char *filename);
+
+    void acquire() {
+      ++references;
+    }
+
+    void release();
+    void complete();
+    void cancel();
+  };
+
+  // readbacks waiting for the GPU, only accessed from the render thread
+  static std::vector<Readback *> pending_readbacks;
+
+  Readback *Readback::start(GLuint framebuffer, Vec2I size, const char *filename) {
+    auto readback = new Readback;
+    readback->size = size;
+
+    if (filename != nullptr) {
+      readback->filename = filename;
+    }
+
+    GLint previous_framebuffer = 0;
+    GAMMA_GL_CHECK(glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous_framebuffer));
+    GAMMA_GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer));
+
+    // the pixels are copied to a buffer, glReadPixels does not wait for the GPU
+    GAMMA_GL_CHECK(glGenBuffers(1, &readback->buffer));
+    GAMMA_GL_CHECK(glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->buffer));
+    GAMMA_GL_CHECK(glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size.x) * size.y * 4, nullptr, GL_STREAM_READ));
+    GAMMA_GL_CHECK(glPixelStorei(GL_PACK_ALIGNMENT, 4));
+    GAMMA_GL_CHECK(glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+    GAMMA_GL_CHECK(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    GAMMA_GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previous_framebuffer)));
+
+    readback->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    readback->acquire(); // for the pending list
+    pending_readbacks.push_back(readback);
+    return readback;
+  }
+
+  void Readback::release() {
+    if (--references > 0) {
+      return;
+    }
+
+    // GL objects are only alive while pending, so this is the render thread when there are some
+    if (fence != nullptr) {
+      GAMMA_GL_CHECK(glDeleteSync(fence));
+    }
+
+    if (buffer != 0) {
+      GAMMA_GL_CHECK(glDeleteBuffers(1, &buffer));
+    }
+
+    if (image.loaded()) {
+      image.destroy();
+    }
+
+    delete this;
+  }
+
+  void Readback::complete() {
+    image = Image(size);
+
+    GAMMA_GL_CHECK(glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer));
+    auto mapped = static_cast<const uint8_t *>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(size.x) * size.y * 4, GL_MAP_READ_BIT));
+
+    if (mapped != nullptr && image.loaded()) {
+      // both are bottom up
+      std::memcpy(image.pixels, mapped, static_cast<std::size_t>(size.x) * size.y * 4);
+      GAMMA_GL_CHECK(glUnmapBuffer(GL_PIXEL_PACK_BUFFER));
+    }
+
+    GAMMA_GL_CHECK(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    GAMMA_GL_CHECK(glDeleteSync(fence));
+    fence = nullptr;
+    GAMMA_GL_CHECK(glDeleteBuffers(1, &buffer));
+    buffer = 0;
+
+    if (mapped == nullptr || !image.loaded()) {
+      status = ReadbackStatus::FAILED;
+      return;
+    }
+
+    if (filename.empty()) {
+      status = ReadbackStatus::READY;
+      return;
+    }
+
+    status = ReadbackStatus::ENCODING;
+    acquire(); // for the encoder
+
+    WorkerPool::get().submit([this]() {
+      bool ok = image.save(filename.c_str());
+      image.destroy();
+      status = ok ? ReadbackStatus::READY : ReadbackStatus::FAILED;
+      release();
+    });
+  }
+
+  void Readback::cancel() {
+    GAMMA_GL_CHECK(glDeleteSync(fence));
+    fence = nullptr;
+    GAMMA_GL_CHECK(glDeleteBuffers(1, &buffer));
+    buffer = 0;
+
+    status = ReadbackStatus::FAILED;
+  }
+
+  bool has_pending_readbacks() {
+    return !pending_readbacks.empty();
+  }
+
+  void process_readbacks() {
+    auto iterator = std::remove_if(pending_readbacks.begin(), pending_readbacks.end(), [](Readback *readback) {
+      GLenum result = glClientWaitSync(readback->fence, 0, 0);
+
+      if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED) {
+        return false;
+      }
+
+      readback->complete();
+      readback->release();
+      return true;
+    });
+
+    pending_readbacks.erase(iterator, pending_readbacks.end());
+  }
+
+  void cancel_readbacks() {
+    for (auto readback : pending_readbacks) {
+      readback->cancel();
+      readback->release();
+    }
+
+    pending_readbacks.clear();
+  }
+
+  struct CaptureApi : CaptureClass {
+
+    static void destroy(AgateVM *vm, const char *unit_name, const char *class_name, void *data) {
+      auto capture = static_cast<Capture *>(data);
+
+      if (capture->handle != nullptr) {
+        agateReleaseHandle(vm, capture->handle);
+        capture->handle = nullptr;
+      }
+
+      if (capture->readback != nullptr) {
+        capture->readback->release();
+        capture->readback = nullptr;
+      }
+    }
+
+    static void is_ready(AgateVM *vm) {
+      assert(agateCheckTag<CaptureClass>(vm, 0));
+      auto capture = agateSlotGet<CaptureClass>(vm, 0);
+      agateSlotSetBool(vm, AGATE_RETURN_SLOT, capture->readback->status == ReadbackStatus::READY);
+    }
+
+    static void has_failed(AgateVM *vm) {
+      assert(agateCheckTag<CaptureClass>(vm, 0));
+      auto capture = agateSlotGet<CaptureClass>(vm, 0);
+      agateSlotSetBool(vm, AGATE_RETURN_SLOT, capture->readback->status == ReadbackStatus::FAILED);
+    }
+
+    static void get_image(AgateVM *vm) {
+      assert(agateCheckTag<CaptureClass>(vm, 0));
+      auto capture = agateSlotGet<CaptureClass>(vm, 0);
+
+      if (capture->handle != nullptr) {
+        agateSlotSetHandle(vm, AGATE_RETURN_SLOT, capture->handle);
+        return;
+      }
+
+      Readback *readback = capture->readback;
+
+      if (!readback->filename.empty()) {
+        agateError(vm, "The capture is saved in a file.");
+        return;
+      }
+
+      if (readback->status != ReadbackStatus::READY) {
+        agateError(vm, "The capture is not finished yet.");
+        return;
+      }
+
+      auto image = agateSlotNew<ImageClass>(vm, AGATE_RETURN_SLOT);
+      *image = readback->image;
+      readback->image = Image();
+
+      capture->handle = agateSlotGetHandle(vm, AGATE_RETURN_SLOT);
+    }
+
+  };
+
   struct RendererApi : RendererClass {
     static void destroy(AgateVM *vm, const char *unit_name, const char *class_name, void *data) {
       auto renderer = static_cast<Renderer *>(data);
@@ -912,7 +1202,111 @@ namespace gma {
     }
 
     static void display(AgateVM *vm) {
-      SDL_GL_SwapWindow(SDL_GL_GetCurrentWindow());
+      assert(agateCheckTag<RendererClass>(vm, 0));
+      auto renderer = agateSlotGet<RendererClass>(vm, 0);
+      renderer->display();
+    }
+
+    // [target,] [filename]
+    static void start_capture(AgateVM *vm, bool with_target, bool with_filename) {
+      assert(agateCheckTag<RendererClass>(vm, 0));
+      auto renderer = agateSlotGet<RendererClass>(vm, 0);
+
+      GLuint framebuffer = 0;
+      Vec2I size = renderer->framebuffer_size;
+
+      if (with_target) {
+        if (!agateCheckTag<TextureClass>(vm, 1)) {
+          agateError(vm, "Texture parameter expected for `target`.");
+          return;
+        }
+
+        auto texture = agateSlotGet<TextureClass>(vm, 1);
+
+        if (texture->framebuffer == 0 || texture->kind != TextureKind::COLOR) {
+          agateError(vm, "The texture is not a render target.");
+          return;
+        }
+
+        framebuffer = texture->framebuffer;
+        size = vec(texture->width, texture->height);
+      }
+
+      const char *filename = nullptr;
+
+      if (with_filename && !agateCheck(vm, with_target ? 2 : 1, filename)) {
+        agateError(vm, "String parameter expected for `filename`.");
+        return;
+      }
+
+      auto capture = agateSlotNew<CaptureClass>(vm, AGATE_RETURN_SLOT);
+      capture->readback = Readback::start(framebuffer, size, filename);
+      capture->handle = nullptr;
+    }
+
+    static void capture0(AgateVM *vm) {
+      start_capture(vm, false, false);
+    }
+
+    static void capture1(AgateVM *vm) {
+      start_capture(vm, true, false);
+    }
+
+    static void capture_to_file1(AgateVM *vm) {
+      start_capture(vm, false, true);
+    }
+
+    static void capture_to_file2(AgateVM *vm) {
+      start_capture(vm, true, true);
+    }
+
+    static void get_upload_budget(AgateVM *vm) {
+      assert(agateCheckTag<RendererClass>(vm, 0));
+      auto renderer = agateSlotGet<RendererClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(renderer->upload_budget));
+    }
+
+    static void set_upload_budget(AgateVM *vm) {
+      assert(agateCheckTag<RendererClass>(vm, 0));
+      auto renderer = agateSlotGet<RendererClass>(vm, 0);
+
+      int64_t budget;
+
+      if (!agateCheck(vm, 1, budget) || budget < 0) {
+        agateError(vm, "Positive Int parameter expected for `value`.");
+        return;
+      }
+
+      renderer->upload_budget = static_cast<std::size_t>(budget);
+      agateSlotCopy(vm, AGATE_RETURN_SLOT, 1);
+    }
+
+    static void get_frame_rate(AgateVM *vm) {
+      assert(agateCheckTag<RendererClass>(vm, 0));
+      auto renderer = agateSlotGet<RendererClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, renderer->frame_rate);
+    }
+
+    static void set_frame_rate(AgateVM *vm) {
+      assert(agateCheckTag<RendererClass>(vm, 0));
+      auto renderer = agateSlotGet<RendererClass>(vm, 0);
+
+      int frame_rate;
+
+      if (!agateCheck(vm, 1, frame_rate) || frame_rate < 0) {
+        agateError(vm, "Non-negative Int parameter expected for `value`.");
+        return;
+      }
+
+      renderer->frame_rate = frame_rate;
+      renderer->frame_deadline = 0;
+      agateSlotCopy(vm, AGATE_RETURN_SLOT, 1);
+    }
+
+    static void get_missed_frames(AgateVM *vm) {
+      assert(agateCheckTag<RendererClass>(vm, 0));
+      auto renderer = agateSlotGet<RendererClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, renderer->missed_frames);
     }
 
     static void set_camera(AgateVM *vm) {
@@ -1098,12 +1492,14 @@ namespace gma {
         auto window = agateSlotGet<WindowClass>(vm, 1);
         SDL_GL_MakeCurrent(window->ptr, renderer->context);
         GAMMA_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, 0));
+        renderer->window_target = true;
         return;
       }
 
       if (agateCheckTag<TextureClass>(vm, 1)) {
         auto texture = agateSlotGet<TextureClass>(vm, 1);
         texture->make_renderable(renderer->framebuffer_size);
+        renderer->window_target = false;
         return;
       }
 
@@ -1112,6 +1508,255 @@ namespace gma {
 
   };
 
+  /*
+   * FrameLoop
+   */
+
+  static AgateHandle *pending_frame_loop = nullptr;
+
+  namespace {
+
+    bool call_frame_loop_callback(AgateVM *vm, AgateHandle *call, AgateHandle *callback, double value) {
+      agateEnsureSlots(vm, 2);
+      agateSlotSetHandle(vm, 0, callback);
+      agateSlotSetFloat(vm, 1, value);
+      return agateCallHandle(vm, call) == AGATE_STATUS_OK;
+    }
+
+  }
+
+  void run_frame_loop(AgateVM *vm) {
+    if (pending_frame_loop == nullptr) {
+      return;
+    }
+
+    AgateHandle *handle = pending_frame_loop;
+    pending_frame_loop = nullptr;
+
+    agateEnsureSlots(vm, 1);
+    agateSlotSetHandle(vm, 0, handle);
+    auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+
+    AgateHandle *call = agateMakeCallHandle(vm, "call(_)");
+    const double timestep = static_cast<double>(loop->timestep) / 1e9;
+
+    // the simulation follows the replayed time, so that the events land in the same updates, the timings stay on the live clock
+    auto & replay = Replay::get();
+    int64_t previous = replay.now();
+    int64_t accumulator = loop->timestep; // the first frame has an update
+    loop->stopped = false;
+
+    while (!loop->stopped && !loop->window->should_close) {
+      const int64_t frame_start = time_now();
+      const int64_t simulation_time = replay.now();
+      accumulator += simulation_time - previous;
+      previous = simulation_time;
+
+      // updates
+
+      int updates = 0;
+
+      while (accumulator >= loop->timestep && updates < loop->max_updates) {
+        if (!call_frame_loop_callback(vm, call, loop->update_callback, timestep)) {
+          loop->stopped = true;
+          break;
+        }
+
+        accumulator -= loop->timestep;
+        ++updates;
+      }
+
+      if (loop->stopped) {
+        break;
+      }
+
+      // the game can not keep up, the late time is dropped instead of piling up
+      if (accumulator >= loop->timestep) {
+        accumulator %= loop->timestep;
+      }
+
+      const int64_t update_end = time_now();
+      loop->update_time = update_end - frame_start;
+
+      // rendering
+
+      loop->alpha = static_cast<double>(accumulator) / static_cast<double>(loop->timestep);
+
+      if (!call_frame_loop_callback(vm, call, loop->render_callback, loop->alpha)) {
+        break;
+      }
+
+      const int64_t render_end = time_now();
+      loop->render_time = render_end - update_end;
+
+      // the frames are paced by the frame rate of the renderer, that sleeps before the swap
+      loop->renderer->display();
+
+      loop->sleep_time = loop->renderer->last_sleep;
+      loop->display_time = time_now() - render_end - loop->sleep_time;
+      ++loop->frames;
+    }
+
+    agateReleaseHandle(vm, call);
+    agateReleaseHandle(vm, handle);
+  }
+
+  struct FrameLoopApi : FrameLoopClass {
+    static void destroy(AgateVM *vm, const char *unit_name, const char *class_name, void *data) {
+      auto loop = static_cast<FrameLoop *>(data);
+
+      for (AgateHandle *handle : { loop->window_handle, loop->renderer_handle, loop->update_callback, loop->render_callback }) {
+        if (handle != nullptr) {
+          agateReleaseHandle(vm, handle);
+        }
+      }
+    }
+
+    static void new3(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+
+      if (!agateCheckTag<WindowClass>(vm, 1)) {
+        agateError(vm, "Window parameter expected for `window`.");
+        return;
+      }
+
+      if (!agateCheckTag<RendererClass>(vm, 2)) {
+        agateError(vm, "Renderer parameter expected for `renderer`.");
+        return;
+      }
+
+      int64_t timestep;
+
+      if (!agateCheck(vm, 3, timestep) || timestep <= 0) {
+        agateError(vm, "Positive Int parameter expected for `timestep`.");
+        return;
+      }
+
+      loop->window = agateSlotGet<WindowClass>(vm, 1);
+      loop->renderer = agateSlotGet<RendererClass>(vm, 2);
+      loop->window_handle = agateSlotGetHandle(vm, 1);
+      loop->renderer_handle = agateSlotGetHandle(vm, 2);
+      loop->update_callback = nullptr;
+      loop->render_callback = nullptr;
+      loop->timestep = timestep;
+      loop->max_updates = 5;
+      loop->stopped = false;
+      loop->alpha = 0.0;
+      loop->frames = 0;
+      loop->update_time = loop->render_time = loop->sleep_time = loop->display_time = 0;
+    }
+
+    static void set_callback(AgateVM *vm, AgateHandle *FrameLoop::* callback) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+
+      if (loop->*callback != nullptr) {
+        agateReleaseHandle(vm, loop->*callback);
+      }
+
+      loop->*callback = agateSlotGetHandle(vm, 1);
+      agateSlotCopy(vm, AGATE_RETURN_SLOT, 1);
+    }
+
+    static void set_update(AgateVM *vm) {
+      set_callback(vm, &FrameLoop::update_callback);
+    }
+
+    static void set_render(AgateVM *vm) {
+      set_callback(vm, &FrameLoop::render_callback);
+    }
+
+    static void get_timestep(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, loop->timestep);
+    }
+
+    static void get_max_updates(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, loop->max_updates);
+    }
+
+    static void set_max_updates(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+
+      int max_updates;
+
+      if (!agateCheck(vm, 1, max_updates) || max_updates < 1) {
+        agateError(vm, "Positive Int parameter expected for `value`.");
+        return;
+      }
+
+      loop->max_updates = max_updates;
+      agateSlotCopy(vm, AGATE_RETURN_SLOT, 1);
+    }
+
+    static void get_alpha(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+      agateSlotSetFloat(vm, AGATE_RETURN_SLOT, loop->alpha);
+    }
+
+    static void get_frames(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, loop->frames);
+    }
+
+    static void get_update_time(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, loop->update_time);
+    }
+
+    static void get_render_time(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, loop->render_time);
+    }
+
+    static void get_sleep_time(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, loop->sleep_time);
+    }
+
+    static void get_display_time(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, loop->display_time);
+    }
+
+    static void start(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+
+      if (loop->update_callback == nullptr || loop->render_callback == nullptr) {
+        agateError(vm, "The update and render callbacks must be set before starting the loop.");
+        return;
+      }
+
+      if (pending_frame_loop != nullptr) {
+        agateError(vm, "A frame loop has already been started.");
+        return;
+      }
+
+      pending_frame_loop = agateSlotGetHandle(vm, 0);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void stop(AgateVM *vm) {
+      assert(agateCheckTag<FrameLoopClass>(vm, 0));
+      auto loop = agateSlotGet<FrameLoopClass>(vm, 0);
+      loop->stopped = true;
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+  };
+
 
   /*
    * RenderUnit
@@ -1121,6 +1766,8 @@ namespace gma {
     support.add_class_handler(unit_name, CameraClass::class_name, generic_simple_handler<CameraClass>());
     support.add_class_handler(unit_name, TransformClass::class_name, generic_simple_handler<TransformClass>());
     support.add_class_handler(unit_name, RendererClass::class_name, generic_handler<RendererClass>(RendererApi::destroy));
+    support.add_class_handler(unit_name, CaptureClass::class_name, generic_handler<CaptureClass>(CaptureApi::destroy));
+    support.add_class_handler(unit_name, FrameLoopClass::class_name, generic_handler<FrameLoopClass>(FrameLoopApi::destroy));
 
     support.add_method(unit_name, CameraApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new_extend(_,_)", CameraApi::new_extend);
     support.add_method(unit_name, CameraApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new_fill(_,_)", CameraApi::new_fill);
@@ -1171,6 +1818,34 @@ namespace gma {
     support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "vsynced", RendererApi::is_vsynced);
     support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "vsynced=(_)", RendererApi::set_vsynced);
     support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "switch_to(_)", RendererApi::switch_to);
+    support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "upload_budget", RendererApi::get_upload_budget);
+    support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "upload_budget=(_)", RendererApi::set_upload_budget);
+    support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "frame_rate", RendererApi::get_frame_rate);
+    support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "frame_rate=(_)", RendererApi::set_frame_rate);
+    support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "missed_frames", RendererApi::get_missed_frames);
+    support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "capture()", RendererApi::capture0);
+    support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "capture(_)", RendererApi::capture1);
+    support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "capture_to_file(_)", RendererApi::capture_to_file1);
+    support.add_method(unit_name, RendererApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "capture_to_file(_,_)", RendererApi::capture_to_file2);
+
+    support.add_method(unit_name, CaptureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "ready", CaptureApi::is_ready);
+    support.add_method(unit_name, CaptureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "failed", CaptureApi::has_failed);
+    support.add_method(unit_name, CaptureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "image", CaptureApi::get_image);
+
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new(_,_,_)", FrameLoopApi::new3);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "update=(_)", FrameLoopApi::set_update);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "render=(_)", FrameLoopApi::set_render);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "timestep", FrameLoopApi::get_timestep);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "max_updates", FrameLoopApi::get_max_updates);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "max_updates=(_)", FrameLoopApi::set_max_updates);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "alpha", FrameLoopApi::get_alpha);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "frames", FrameLoopApi::get_frames);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "update_time", FrameLoopApi::get_update_time);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "render_time", FrameLoopApi::get_render_time);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "sleep_time", FrameLoopApi::get_sleep_time);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "display_time", FrameLoopApi::get_display_time);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "start()", FrameLoopApi::start);
+    support.add_method(unit_name, FrameLoopApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "stop()", FrameLoopApi::stop);
   }
 
 }
@@ -1,6 +1,8 @@
 #ifndef GAMMA_RENDER_H
 #define GAMMA_RENDER_H
 
+#include <cstddef>
+
 #include <SDL2/SDL.h>
 #include "glad/glad.h"
 
@@ -118,11 +120,20 @@ namespace gma {
     Vec2I framebuffer_size;
     Camera camera;
 
+    std::size_t upload_budget; // bytes of asynchronous texture uploads per frame
+
+    int frame_rate; // target frames per second, 0 for no limit
+    int64_t frame_deadline; // time of the next swap, 0 when unknown
+    int64_t missed_frames; // frames that were ready after their deadline
+    int64_t last_sleep; // time waited for the deadline before the last swap
+    bool window_target; // false while rendering to a texture, that does not count as a frame
+
     Renderer() = default;
     Renderer(AgateVM *vm, Window *window);
 
     void destroy();
 
+    void display();
     void draw(const RendererData& submitted_data);
     Vec2I world_to_device(Vec2F position, const Camera *camera);
     Vec2F device_to_world(Vec2I coordinates, const Camera *camera);
@@ -134,6 +145,65 @@ namespace gma {
     static constexpr uint64_t tag = compute_tag(unit_name, class_name);
   };
 
+  /*
+   * Capture
+   */
+
+  struct Readback;
+
+  // an asynchronous readback of a render target, completed a few frames later
+  struct Capture {
+    Readback *readback;
+    AgateHandle *handle; // the captured image, once it has been requested
+  };
+
+  struct CaptureClass : RenderUnit {
+    using type = Capture;
+    static constexpr const char * class_name = "Capture";
+    static constexpr uint64_t tag = compute_tag(unit_name, class_name);
+  };
+
+  // complete the readbacks whose pixels have arrived
+  void process_readbacks();
+  bool has_pending_readbacks();
+  // fail the pending readbacks, before their GL objects are destroyed with the context
+  void cancel_readbacks();
+
+  /*
+   * FrameLoop
+   */
+
+  // a fixed timestep main loop that calls back the script for the updates and the rendering, paced by Renderer::frame_rate
+  struct FrameLoop {
+    Window *window;
+    Renderer *renderer;
+    AgateHandle *window_handle;
+    AgateHandle *renderer_handle;
+    AgateHandle *update_callback; // called with the timestep in seconds
+    AgateHandle *render_callback; // called with the interpolation alpha
+
+    int64_t timestep;
+    int max_updates; // updates in a frame before the late time is dropped
+    bool stopped;
+
+    // statistics of the last frame
+    double alpha;
+    int64_t frames;
+    int64_t update_time;
+    int64_t render_time;
+    int64_t sleep_time;
+    int64_t display_time;
+  };
+
+  struct FrameLoopClass : RenderUnit {
+    using type = FrameLoop;
+    static constexpr const char * class_name = "FrameLoop";
+    static constexpr uint64_t tag = compute_tag(unit_name, class_name);
+  };
+
+  // run the frame loop started by the script, once the main unit has returned
+  void run_frame_loop(AgateVM *vm);
+
 }
 
 #endif // GAMMA_RENDER_H
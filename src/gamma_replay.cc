@@ -0,0 +1,203 @@
+#include "gamma_replay.h"
+
+#include <cassert>
+#include <cstring>
+
+#include "gamma_file.h"
+#include "gamma_time.h"
+
+namespace gma {
+
+  namespace {
+
+    // the events with pointers can not be replayed
+    bool is_replayable(const SDL_Event& event) {
+      switch (event.type) {
+        case SDL_SYSWMEVENT:
+        case SDL_DROPFILE:
+        case SDL_DROPTEXT:
+          return false;
+        default:
+          return event.type < SDL_USEREVENT;
+      }
+    }
+
+  }
+
+  bool Replay::start_recording(const char *filename) {
+    assert(mode == ReplayMode::NONE);
+    file = std::fopen(filename, "wb");
+
+    if (file == nullptr) {
+      return false;
+    }
+
+    ReplayHeader header;
+    std::memcpy(header.magic, ReplayMagic, sizeof header.magic);
+    header.version = ReplayVersion;
+    header.event_size = sizeof(SDL_Event);
+    header.reserved = 0;
+
+    if (std::fwrite(&header, sizeof header, 1, file) != 1) {
+      std::fclose(file);
+      file = nullptr;
+      return false;
+    }
+
+    mode = ReplayMode::RECORD;
+    frame = 0;
+    return true;
+  }
+
+  bool Replay::start_replay(const char *filename) {
+    assert(mode == ReplayMode::NONE);
+    FileMapping mapping(filename);
+
+    if (!mapping.loaded()) {
+      return false;
+    }
+
+    bool valid = false;
+
+    if (mapping.size >= sizeof(ReplayHeader)) {
+      ReplayHeader header;
+      std::memcpy(&header, mapping.data, sizeof header);
+      valid = std::memcmp(header.magic, ReplayMagic, sizeof ReplayMagic) == 0 && header.version == ReplayVersion && header.event_size == sizeof(SDL_Event);
+    }
+
+    std::size_t offset = sizeof(ReplayHeader);
+
+    while (valid && offset < mapping.size) {
+      ReplayRecord record;
+
+      if (mapping.size - offset < sizeof record) {
+        valid = false;
+        break;
+      }
+
+      std::memcpy(&record, mapping.data + offset, sizeof record);
+      offset += sizeof record;
+
+      switch (record.type) {
+        case ReplayRecordType::EVENT:
+          if (mapping.size - offset < sizeof(SDL_Event)) {
+            valid = false;
+            break;
+          }
+
+          events.push_back({ record.frame, SDL_Event() });
+          std::memcpy(&events.back().event, mapping.data + offset, sizeof(SDL_Event));
+          offset += sizeof(SDL_Event);
+          break;
+
+        case ReplayRecordType::TIME:
+          times.push_back({ record.frame, record.time });
+          break;
+
+        default:
+          valid = false;
+          break;
+      }
+    }
+
+    mapping.destroy();
+
+    if (!valid) {
+      events.clear();
+      times.clear();
+      return false;
+    }
+
+    mode = ReplayMode::REPLAY;
+    frame = 0;
+    next_event_index = next_time_index = 0;
+    last_time = times.empty() ? time_now() : times.front().value;
+    return true;
+  }
+
+  void Replay::stop() {
+    if (file != nullptr) {
+      if (std::fclose(file) != 0) {
+        std::fprintf(stderr, "Unable to write the replay.\n");
+      }
+
+      file = nullptr;
+    }
+
+    if (mode == ReplayMode::REPLAY) {
+      time_offset = last_time - time_now();
+    }
+
+    events.clear();
+    times.clear();
+    mode = ReplayMode::NONE;
+  }
+
+  void Replay::record_event(const SDL_Event& event) {
+    if (mode != ReplayMode::RECORD || !is_replayable(event)) {
+      return;
+    }
+
+    ReplayRecord record = { ReplayRecordType::EVENT, frame, time_now() };
+    std::fwrite(&record, sizeof record, 1, file);
+    std::fwrite(&event, sizeof event, 1, file);
+  }
+
+  bool Replay::peek_event(SDL_Event& event) const {
+    // the events of a frame that the script did not poll are given at the next poll
+    if (next_event_index < events.size() && events[next_event_index].frame <= frame) {
+      event = events[next_event_index].event;
+      return true;
+    }
+
+    return false;
+  }
+
+  bool Replay::poll_event(SDL_Event& event) {
+    if (!peek_event(event)) {
+      return false;
+    }
+
+    ++next_event_index;
+    return true;
+  }
+
+  int64_t Replay::now() {
+    switch (mode) {
+      case ReplayMode::NONE:
+        return time_now() + time_offset;
+
+      case ReplayMode::RECORD: {
+        int64_t value = time_now();
+        ReplayRecord record = { ReplayRecordType::TIME, frame, value };
+        std::fwrite(&record, sizeof record, 1, file);
+        return value;
+      }
+
+      case ReplayMode::REPLAY:
+        // if the script asks more often than during the recording, time stands still until the next frame
+        if (next_time_index < times.size() && times[next_time_index].frame <= frame) {
+          last_time = times[next_time_index++].value;
+        }
+
+        return last_time;
+    }
+
+    return time_now();
+  }
+
+  void Replay::end_frame() {
+    ++frame;
+
+    if (mode == ReplayMode::REPLAY && next_event_index == events.size() && next_time_index == times.size()) {
+      std::fprintf(stderr, "Replay finished at frame %u.\n", frame);
+      stop();
+    }
+  }
+
+  Replay& Replay::get() {
+    static Replay replay;
+    return replay;
+  }
+
+}
@@ -0,0 +1,105 @@
+#ifndef GAMMA_REPLAY_H
+#define GAMMA_REPLAY_H
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include <SDL2/SDL.h>
+
+namespace gma {
+
+  /*
+   * Replay
+   */
+
+  // replay file layout, in the byte order of the recording machine:
+  // - a header
+  // - the records in frame order, an event record is followed by the SDL_Event
+
+  inline constexpr char ReplayMagic[4] = { 'G', 'R', 'P', 'L' };
+  inline constexpr uint32_t ReplayVersion = 1;
+
+  struct ReplayHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t event_size; // sizeof(SDL_Event), replays are not portable across SDL builds
+    uint32_t reserved;
+  };
+
+  static_assert(sizeof(ReplayHeader) == 16);
+
+  enum class ReplayRecordType : uint32_t {
+    EVENT,
+    TIME,
+  };
+
+  struct ReplayRecord {
+    ReplayRecordType type;
+    uint32_t frame;
+    int64_t time; // the value of Time.now for a time record, the time of the poll for an event record
+  };
+
+  static_assert(sizeof(ReplayRecord) == 16);
+
+  enum class ReplayMode {
+    NONE,
+    RECORD,
+    REPLAY,
+  };
+
+  // the events consumed by the scripts and the values of Time.now, by frame
+  struct Replay {
+    struct TimedEvent {
+      uint32_t frame;
+      SDL_Event event;
+    };
+
+    struct Time {
+      uint32_t frame;
+      int64_t value;
+    };
+
+    ReplayMode mode = ReplayMode::NONE;
+    uint32_t frame = 0;
+
+    // record
+    std::FILE *file = nullptr;
+
+    // replay
+    std::vector<TimedEvent> events;
+    std::vector<Time> times;
+    std::size_t next_event_index = 0;
+    std::size_t next_time_index = 0;
+    int64_t last_time = 0;
+    int64_t time_offset = 0; // added to the clock once the replay is finished, so that Time.now does not jump
+
+    bool start_recording(const char *filename);
+    bool start_replay(const char *filename);
+    void stop();
+
+    bool recording() const {
+      return mode == ReplayMode::RECORD;
+    }
+
+    bool replaying() const {
+      return mode == ReplayMode::REPLAY;
+    }
+
+    void record_event(const SDL_Event& event);
+
+    // the recorded events of the current frame
+    bool peek_event(SDL_Event& event) const;
+    bool poll_event(SDL_Event& event);
+
+    // the value of Time.now, recorded or replayed
+    int64_t now();
+
+    void end_frame();
+
+    static Replay& get();
+  };
+
+}
+
+#endif // GAMMA_REPLAY_H
@@ -0,0 +1,75 @@
+#include "gamma_sdl.h"
+
+#include <atomic>
+#include <cstdio>
+
+#include "gamecontrollerdb.txt.h"
+
+namespace gma {
+
+  // 0 until the events are initialized
+  static std::atomic<Uint32> wake_event_type = 0;
+
+  bool sdl_require(Uint32 subsystems) {
+    Uint32 missing = subsystems & ~SDL_WasInit(subsystems);
+
+    if (missing == 0) {
+      return true;
+    }
+
+    if (SDL_InitSubSystem(missing) != 0) {
+      return false;
+    }
+
+    if (wake_event_type == 0 && SDL_WasInit(SDL_INIT_EVENTS) != 0) {
+      if (Uint32 type = SDL_RegisterEvents(1); type != static_cast<Uint32>(-1)) {
+        wake_event_type = type;
+      }
+    }
+
+    return true;
+  }
+
+  void sdl_load_gamepad_mappings() {
+    static bool loaded = false;
+
+    if (loaded) {
+      return;
+    }
+
+    loaded = true;
+
+    // the joysticks already connected that get a mapping are announced with SDL_CONTROLLERDEVICEADDED
+    int added = SDL_GameControllerAddMappingsFromRW(SDL_RWFromConstMem(gamma_gamecontrollerdb, sizeof gamma_gamecontrollerdb), 1);
+
+    if (added == -1) {
+      std::fprintf(stderr, "Unable to load game controller mappings: %s\n", SDL_GetError());
+    }
+  }
+
+  void sdl_wake() {
+    const Uint32 type = wake_event_type;
+
+    if (type == 0) {
+      return;
+    }
+
+    // SDL_PushEvent() is thread safe
+    SDL_Event event;
+    SDL_zero(event);
+    event.type = type;
+    SDL_PushEvent(&event);
+  }
+
+  bool sdl_flush_wake() {
+    const Uint32 type = wake_event_type;
+
+    if (type == 0 || !SDL_HasEvent(type)) {
+      return false;
+    }
+
+    SDL_FlushEvent(type);
+    return true;
+  }
+
+}
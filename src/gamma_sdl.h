@@ -0,0 +1,25 @@
+#ifndef GAMMA_SDL_H
+#define GAMMA_SDL_H
+
+#include <SDL2/SDL.h>
+
+namespace gma {
+
+  /*
+   * SDL subsystems
+   */
+
+  // initialize the subsystems on their first use, they are all shut down by SDL_Quit()
+  bool sdl_require(Uint32 subsystems);
+
+  // parse the embedded game controller mappings, once, when the first joystick is connected
+  void sdl_load_gamepad_mappings();
+
+  // wake up Event.wait() from any thread, when some background work is ready for the next frame
+  void sdl_wake();
+  // remove the wake ups from the event queue, and tell if there were some
+  bool sdl_flush_wake();
+
+}
+
+#endif // GAMMA_SDL_H
@@ -0,0 +1,23 @@
+#ifndef GAMMA_SIMD_H
+#define GAMMA_SIMD_H
+
+// SSE2 is always available on x86-64, AVX2 must be enabled at build time (GAMMA_USE_AVX2)
+
+#if defined(__AVX2__)
+  #define GAMMA_HAS_AVX2
+#endif
+
+// SSSE3 is implied by AVX2
+#if defined(__SSSE3__) || defined(GAMMA_HAS_AVX2)
+  #define GAMMA_HAS_SSSE3
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define GAMMA_HAS_SSE2
+#endif
+
+#if defined(GAMMA_HAS_AVX2) || defined(GAMMA_HAS_SSE2)
+  #include <immintrin.h>
+#endif
+
+#endif // GAMMA_SIMD_H
@@ -1,14 +1,34 @@
 #include "gamma_sprite.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
 #define STBI_WINDOWS_UTF8
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
 
 #include "gamma_agate.h"
 #include "gamma_debug.h"
+#include "gamma_file.h"
+#include "gamma_qoi.h"
 #include "gamma_render.h"
+#include "gamma_sdl.h"
+#include "gamma_simd.h"
+#include "gamma_thread.h"
 
 namespace gma {
 
@@ -16,11 +36,75 @@ namespace gma {
    * Image
    */
 
-  Image::Image(const char *filename) {
-    stbi_set_flip_vertically_on_load(true);
-    [[maybe_unused]] int n = 0;
-    pixels = stbi_load(filename, &width, &height, &n, STBI_rgb_alpha);
-    assert(n == 4);
+  Image::Image(const char *filename)
+  : width(0)
+  , height(0)
+  , pixels(nullptr)
+  , dirty({ { 0, 0 }, { 0, 0 } })
+  {
+    FileMapping file(filename);
+
+    if (!file.loaded()) {
+      return;
+    }
+
+    // QOI is recognized by its magic, so that converted assets can keep their original names
+    if (qoi_check_magic(file.data, file.size)) {
+      pixels = qoi_decode(file.data, file.size, width, height);
+      file.destroy();
+
+      if (pixels == nullptr) {
+        width = height = 0;
+      }
+
+      return;
+    }
+
+    int n = 0;
+    pixels = stbi_load_from_memory(file.data, static_cast<int>(file.size), &width, &height, &n, STBI_rgb_alpha);
+    file.destroy();
+
+    if (pixels == nullptr) {
+      width = height = 0;
+      return;
+    }
+
+    // flip here rather than with the global stb_image setting, so that images can be loaded from any thread
+    const std::size_t stride = static_cast<std::size_t>(width) * 4;
+
+    for (int y = 0; y < height / 2; ++y) {
+      std::swap_ranges(pixels + y * stride, pixels + (y + 1) * stride, pixels + (height - y - 1) * stride);
+    }
+  }
+
+  bool Image::read_size(const char *filename, int& width, int& height) {
+    FileMapping file(filename);
+
+    if (!file.loaded()) {
+      return false;
+    }
+
+    bool result = false;
+
+    if (qoi_check_magic(file.data, file.size)) {
+      result = qoi_read_size(file.data, file.size, width, height);
+    } else {
+      int n = 0;
+      result = stbi_info_from_memory(file.data, static_cast<int>(file.size), &width, &height, &n) != 0;
+    }
+
+    file.destroy();
+    return result;
+  }
+
+  Image::Image(Vec2I size)
+  : width(size.x)
+  , height(size.y)
+  , pixels(nullptr)
+  , dirty({ { 0, 0 }, { 0, 0 } })
+  {
+    // allocated like stb_image does, so that destroy() works for both
+    pixels = static_cast<uint8_t *>(std::calloc(static_cast<std::size_t>(width) * height, 4));
   }
 
   void Image::destroy() {
@@ -29,6 +113,62 @@ namespace gma {
     width = height = 0;
   }
 
+  bool Image::save(const char *filename) const {
+    std::string_view name(filename);
+
+    if (name.size() >= 4 && name.compare(name.size() - 4, 4, ".qoi") == 0) {
+      return save_qoi(filename);
+    }
+
+    return save_png(filename);
+  }
+
+  bool Image::save_png(const char *filename) const {
+    if (!loaded()) {
+      return false;
+    }
+
+    // start from the last row with a negative stride to write the image top down
+    const int stride = width * 4;
+    return stbi_write_png(filename, width, height, 4, pixels + (height - 1) * stride, - stride) != 0;
+  }
+
+  bool Image::save_qoi(const char *filename) const {
+    if (!loaded()) {
+      return false;
+    }
+
+    std::vector<uint8_t> bytes = qoi_encode(pixels, width, height);
+
+    if (bytes.empty()) {
+      return false;
+    }
+
+    std::FILE *file = std::fopen(filename, "wb");
+
+    if (file == nullptr) {
+      return false;
+    }
+
+    const bool written = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    return std::fclose(file) == 0 && written;
+  }
+
+  void Image::mark_dirty(RectI rect) {
+    if (rect.size.x <= 0 || rect.size.y <= 0) {
+      return;
+    }
+
+    if (!is_dirty()) {
+      dirty = rect;
+      return;
+    }
+
+    Vec2I min = vec(std::min(dirty.position.x, rect.position.x), std::min(dirty.position.y, rect.position.y));
+    Vec2I max = vec(std::max(dirty.position.x + dirty.size.x, rect.position.x + rect.size.x), std::max(dirty.position.y + dirty.size.y, rect.position.y + rect.size.y));
+    dirty = { min, max - min };
+  }
+
   Color Image::get_color(Vec2I position) const {
     Color color;
 
@@ -55,6 +195,593 @@ namespace gma {
     ptr[1] = (uint8_t) (255 * std::clamp(color.g, 0.0f, 1.0f));
     ptr[2] = (uint8_t) (255 * std::clamp(color.b, 0.0f, 1.0f));
     ptr[3] = (uint8_t) (255 * std::clamp(color.a, 0.0f, 1.0f));
+
+    mark_dirty({ position, { 1, 1 } });
+  }
+
+  namespace {
+
+    uint32_t to_rgba32(Color color) {
+      uint8_t bytes[4];
+      bytes[0] = (uint8_t) (255 * std::clamp(color.r, 0.0f, 1.0f));
+      bytes[1] = (uint8_t) (255 * std::clamp(color.g, 0.0f, 1.0f));
+      bytes[2] = (uint8_t) (255 * std::clamp(color.b, 0.0f, 1.0f));
+      bytes[3] = (uint8_t) (255 * std::clamp(color.a, 0.0f, 1.0f));
+
+      uint32_t pixel;
+      std::memcpy(&pixel, bytes, sizeof(pixel));
+      return pixel;
+    }
+
+    // clip `rect` to the image
+    RectI clip_rect(RectI rect, int width, int height) {
+      int x0 = std::max(rect.position.x, 0);
+      int y0 = std::max(rect.position.y, 0);
+      int x1 = std::min(rect.position.x + rect.size.x, width);
+      int y1 = std::min(rect.position.y + rect.size.y, height);
+      return { { x0, y0 }, { std::max(x1 - x0, 0), std::max(y1 - y0, 0) } };
+    }
+
+    // clip a source rectangle copied at `position` to both images
+    bool clip_transfer(RectI& source_rect, Vec2I& position, const Image& source, const Image& target) {
+      RectI clipped = clip_rect(source_rect, source.width, source.height);
+      position += clipped.position - source_rect.position;
+
+      RectI target_rect = clip_rect({ position, clipped.size }, target.width, target.height);
+      clipped.position += target_rect.position - position;
+      clipped.size = target_rect.size;
+
+      source_rect = clipped;
+      position = target_rect.position;
+      return source_rect.size.x > 0 && source_rect.size.y > 0;
+    }
+
+    void fill_row(uint8_t *row, int count, uint32_t pixel) {
+      int i = 0;
+
+#if defined(GAMMA_HAS_AVX2)
+      const __m256i value = _mm256_set1_epi32(static_cast<int>(pixel));
+
+      for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(row + i * 4), value);
+      }
+#elif defined(GAMMA_HAS_SSE2)
+      const __m128i value = _mm_set1_epi32(static_cast<int>(pixel));
+
+      for (; i + 4 <= count; i += 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(row + i * 4), value);
+      }
+#endif
+
+      for (; i < count; ++i) {
+        std::memcpy(row + i * 4, &pixel, 4);
+      }
+    }
+
+    // exact rounded division by 255 of a value in [0, 255 * 255]
+    uint8_t div255(unsigned value) {
+      value += 128;
+      return static_cast<uint8_t>((value + (value >> 8)) >> 8);
+    }
+
+#if defined(GAMMA_HAS_AVX2)
+    // blend 4 pixels widened to 16 bits per channel
+    __m256i blend_pixels(__m256i source, __m256i target) {
+      const __m256i rgb_mask = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1);
+      const __m256i alpha_lane = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+
+      __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(source, 0xFF), 0xFF);
+      __m256i source_factor = _mm256_or_si256(_mm256_and_si256(alpha, rgb_mask), alpha_lane);
+      __m256i target_factor = _mm256_sub_epi16(_mm256_set1_epi16(255), alpha);
+
+      __m256i sum = _mm256_add_epi16(_mm256_mullo_epi16(source, source_factor), _mm256_mullo_epi16(target, target_factor));
+      sum = _mm256_add_epi16(sum, _mm256_set1_epi16(128));
+      return _mm256_srli_epi16(_mm256_add_epi16(sum, _mm256_srli_epi16(sum, 8)), 8);
+    }
+#elif defined(GAMMA_HAS_SSE2)
+    // blend 2 pixels widened to 16 bits per channel
+    __m128i blend_pixels(__m128i source, __m128i target) {
+      const __m128i rgb_mask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+      const __m128i alpha_lane = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+
+      __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(source, 0xFF), 0xFF);
+      __m128i source_factor = _mm_or_si128(_mm_and_si128(alpha, rgb_mask), alpha_lane);
+      __m128i target_factor = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+
+      __m128i sum = _mm_add_epi16(_mm_mullo_epi16(source, source_factor), _mm_mullo_epi16(target, target_factor));
+      sum = _mm_add_epi16(sum, _mm_set1_epi16(128));
+      return _mm_srli_epi16(_mm_add_epi16(sum, _mm_srli_epi16(sum, 8)), 8);
+    }
+#endif
+
+    // same as SDL_BLENDMODE_BLEND: rgb = src.rgb * src.a + dst.rgb * (1 - src.a), a = src.a + dst.a * (1 - src.a)
+    void blend_row(uint8_t *target, const uint8_t *source, int count) {
+      int i = 0;
+
+#if defined(GAMMA_HAS_AVX2)
+      const __m256i alpha_bytes = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+      const __m256i zero = _mm256_setzero_si256();
+
+      for (; i + 8 <= count; i += 8) {
+        __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i * 4));
+        __m256i alpha = _mm256_and_si256(s, alpha_bytes);
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(alpha, zero)) == -1) {
+          continue; // fully transparent
+        }
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(alpha, alpha_bytes)) == -1) {
+          _mm256_storeu_si256(reinterpret_cast<__m256i *>(target + i * 4), s); // fully opaque
+          continue;
+        }
+
+        __m256i t = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(target + i * 4));
+        __m256i lo = blend_pixels(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(t, zero));
+        __m256i hi = blend_pixels(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(t, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(target + i * 4), _mm256_packus_epi16(lo, hi));
+      }
+#elif defined(GAMMA_HAS_SSE2)
+      const __m128i alpha_bytes = _mm_set1_epi32(static_cast<int>(0xFF000000));
+      const __m128i zero = _mm_setzero_si128();
+
+      for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4));
+        __m128i alpha = _mm_and_si128(s, alpha_bytes);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(alpha, zero)) == 0xFFFF) {
+          continue; // fully transparent
+        }
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(alpha, alpha_bytes)) == 0xFFFF) {
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(target + i * 4), s); // fully opaque
+          continue;
+        }
+
+        __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i *>(target + i * 4));
+        __m128i lo = blend_pixels(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(t, zero));
+        __m128i hi = blend_pixels(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(t, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(target + i * 4), _mm_packus_epi16(lo, hi));
+      }
+#endif
+
+      for (; i < count; ++i) {
+        const uint8_t *s = source + i * 4;
+        uint8_t *t = target + i * 4;
+        const unsigned alpha = s[3];
+
+        t[0] = div255(s[0] * alpha + t[0] * (255 - alpha));
+        t[1] = div255(s[1] * alpha + t[1] * (255 - alpha));
+        t[2] = div255(s[2] * alpha + t[2] * (255 - alpha));
+        t[3] = div255(alpha * 255 + t[3] * (255 - alpha));
+      }
+    }
+
+  }
+
+  void Image::fill(RectI rect, Color color) {
+    rect = clip_rect(rect, width, height);
+    const uint32_t pixel = to_rgba32(color);
+
+    for (int y = rect.position.y; y < rect.position.y + rect.size.y; ++y) {
+      fill_row(get_row(y) + rect.position.x * 4, rect.size.x, pixel);
+    }
+
+    mark_dirty(rect);
+  }
+
+  void Image::copy(const Image& source, RectI source_rect, Vec2I position) {
+    if (!clip_transfer(source_rect, position, source, *this)) {
+      return;
+    }
+
+    // the source may be this image, copy the rows in the direction that does not overwrite them
+    const bool backward = &source == this && position.y > source_rect.position.y;
+
+    for (int i = 0; i < source_rect.size.y; ++i) {
+      const int y = backward ? source_rect.size.y - i - 1 : i;
+      std::memmove(get_row(position.y + y) + position.x * 4, source.get_row(source_rect.position.y + y) + source_rect.position.x * 4, source_rect.size.x * 4);
+    }
+
+    mark_dirty({ position, source_rect.size });
+  }
+
+  void Image::blend(const Image& source, RectI source_rect, Vec2I position) {
+    if (!clip_transfer(source_rect, position, source, *this)) {
+      return;
+    }
+
+    // the source may be this image, blend the rows in the direction that does not overwrite them
+    const bool backward = &source == this && position.y > source_rect.position.y;
+
+    // within the same row, the vectorized blend can not walk backward, so the source row is copied first
+    const bool same_rows = &source == this && position.y == source_rect.position.y;
+    std::vector<uint8_t> buffer;
+
+    if (same_rows) {
+      buffer.resize(static_cast<std::size_t>(source_rect.size.x) * 4);
+    }
+
+    for (int i = 0; i < source_rect.size.y; ++i) {
+      const int y = backward ? source_rect.size.y - i - 1 : i;
+      const uint8_t *source_row = source.get_row(source_rect.position.y + y) + source_rect.position.x * 4;
+
+      if (same_rows) {
+        std::memcpy(buffer.data(), source_row, buffer.size());
+        source_row = buffer.data();
+      }
+
+      blend_row(get_row(position.y + y) + position.x * 4, source_row, source_rect.size.x);
+    }
+
+    mark_dirty({ position, source_rect.size });
+  }
+
+  void Image::apply_lut(const uint8_t lut[4][256]) {
+    // table lookups do not vectorize well (no byte gather), the loop is unrolled per pixel instead
+    const std::size_t count = static_cast<std::size_t>(width) * height;
+    uint8_t *ptr = pixels;
+
+    for (std::size_t i = 0; i < count; ++i) {
+      ptr[0] = lut[0][ptr[0]];
+      ptr[1] = lut[1][ptr[1]];
+      ptr[2] = lut[2][ptr[2]];
+      ptr[3] = lut[3][ptr[3]];
+      ptr += 4;
+    }
+
+    mark_all_dirty();
+  }
+
+  void Image::read_rows(int y, int count, uint8_t *data) const {
+    assert(0 <= y && y + count <= height);
+    const std::size_t stride = static_cast<std::size_t>(width) * 4;
+
+    for (int i = 0; i < count; ++i) {
+      std::memcpy(data + i * stride, get_row(y + i), stride);
+    }
+  }
+
+  void Image::write_rows(int y, int count, const uint8_t *data) {
+    assert(0 <= y && y + count <= height);
+    const std::size_t stride = static_cast<std::size_t>(width) * 4;
+
+    for (int i = 0; i < count; ++i) {
+      std::memcpy(get_row(y + i), data + i * stride, stride);
+    }
+
+    mark_dirty({ { 0, y }, { width, count } });
+  }
+
+  /*
+   * Image filters
+   */
+
+  namespace {
+
+    // minimum number of rows processed by a thread
+    constexpr int BandGrain = 32;
+
+#if defined(GAMMA_HAS_SSE2)
+    using PixelF = __m128;
+
+    PixelF load_pixel(const uint8_t *ptr) {
+      int32_t raw;
+      std::memcpy(&raw, ptr, sizeof(raw));
+      const __m128i zero = _mm_setzero_si128();
+      __m128i wide = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(raw), zero), zero);
+      return _mm_cvtepi32_ps(wide);
+    }
+
+    void store_pixel(uint8_t *ptr, PixelF pixel) {
+      pixel = _mm_min_ps(_mm_max_ps(pixel, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+      __m128i narrow = _mm_cvtps_epi32(pixel);
+      narrow = _mm_packs_epi32(narrow, narrow);
+      narrow = _mm_packus_epi16(narrow, narrow);
+      int32_t raw = _mm_cvtsi128_si32(narrow);
+      std::memcpy(ptr, &raw, sizeof(raw));
+    }
+
+    PixelF load_float_pixel(const float *ptr) {
+      return _mm_loadu_ps(ptr);
+    }
+
+    void store_float_pixel(float *ptr, PixelF pixel) {
+      _mm_storeu_ps(ptr, pixel);
+    }
+
+    PixelF zero_pixel() {
+      return _mm_setzero_ps();
+    }
+
+    PixelF multiply_add(PixelF accumulator, PixelF pixel, float weight) {
+      return _mm_add_ps(accumulator, _mm_mul_ps(pixel, _mm_set1_ps(weight)));
+    }
+#else
+    struct PixelF {
+      float c[4];
+    };
+
+    PixelF load_pixel(const uint8_t *ptr) {
+      return { { float(ptr[0]), float(ptr[1]), float(ptr[2]), float(ptr[3]) } };
+    }
+
+    void store_pixel(uint8_t *ptr, PixelF pixel) {
+      for (int i = 0; i < 4; ++i) {
+        ptr[i] = static_cast<uint8_t>(std::lround(std::clamp(pixel.c[i], 0.0f, 255.0f)));
+      }
+    }
+
+    PixelF load_float_pixel(const float *ptr) {
+      return { { ptr[0], ptr[1], ptr[2], ptr[3] } };
+    }
+
+    void store_float_pixel(float *ptr, PixelF pixel) {
+      std::memcpy(ptr, pixel.c, sizeof(pixel.c));
+    }
+
+    PixelF zero_pixel() {
+      return { { 0.0f, 0.0f, 0.0f, 0.0f } };
+    }
+
+    PixelF multiply_add(PixelF accumulator, PixelF pixel, float weight) {
+      for (int i = 0; i < 4; ++i) {
+        accumulator.c[i] += pixel.c[i] * weight;
+      }
+
+      return accumulator;
+    }
+#endif
+
+    void color_matrix_row(uint8_t *row, int count, const float matrix[4][5]) {
+#if defined(GAMMA_HAS_SSE2)
+      // one column per input channel, the four output channels are computed at once
+      const __m128 column_r = _mm_setr_ps(matrix[0][0], matrix[1][0], matrix[2][0], matrix[3][0]);
+      const __m128 column_g = _mm_setr_ps(matrix[0][1], matrix[1][1], matrix[2][1], matrix[3][1]);
+      const __m128 column_b = _mm_setr_ps(matrix[0][2], matrix[1][2], matrix[2][2], matrix[3][2]);
+      const __m128 column_a = _mm_setr_ps(matrix[0][3], matrix[1][3], matrix[2][3], matrix[3][3]);
+      const __m128 offset = _mm_mul_ps(_mm_setr_ps(matrix[0][4], matrix[1][4], matrix[2][4], matrix[3][4]), _mm_set1_ps(255.0f));
+
+      for (int i = 0; i < count; ++i) {
+        __m128 pixel = load_pixel(row + i * 4);
+        __m128 result = offset;
+        result = _mm_add_ps(result, _mm_mul_ps(column_r, _mm_shuffle_ps(pixel, pixel, 0x00)));
+        result = _mm_add_ps(result, _mm_mul_ps(column_g, _mm_shuffle_ps(pixel, pixel, 0x55)));
+        result = _mm_add_ps(result, _mm_mul_ps(column_b, _mm_shuffle_ps(pixel, pixel, 0xAA)));
+        result = _mm_add_ps(result, _mm_mul_ps(column_a, _mm_shuffle_ps(pixel, pixel, 0xFF)));
+        store_pixel(row + i * 4, result);
+      }
+#else
+      for (int i = 0; i < count; ++i) {
+        PixelF pixel = load_pixel(row + i * 4);
+        PixelF result;
+
+        for (int j = 0; j < 4; ++j) {
+          const float *line = matrix[j];
+          result.c[j] = line[0] * pixel.c[0] + line[1] * pixel.c[1] + line[2] * pixel.c[2] + line[3] * pixel.c[3] + line[4] * 255.0f;
+        }
+
+        store_pixel(row + i * 4, result);
+      }
+#endif
+    }
+
+    void premultiply_row(uint8_t *row, int count) {
+      int i = 0;
+
+#if defined(GAMMA_HAS_SSE2)
+      const __m128i zero = _mm_setzero_si128();
+      const __m128i rgb_mask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+      const __m128i alpha_lane = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+
+      auto premultiply_pixels = [&](__m128i pixels) {
+        __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, 0xFF), 0xFF);
+        __m128i factor = _mm_or_si128(_mm_and_si128(alpha, rgb_mask), alpha_lane);
+        __m128i product = _mm_add_epi16(_mm_mullo_epi16(pixels, factor), _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+      };
+
+      for (; i + 4 <= count; i += 4) {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + i * 4));
+        __m128i lo = premultiply_pixels(_mm_unpacklo_epi8(pixels, zero));
+        __m128i hi = premultiply_pixels(_mm_unpackhi_epi8(pixels, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(row + i * 4), _mm_packus_epi16(lo, hi));
+      }
+#endif
+
+      for (; i < count; ++i) {
+        uint8_t *ptr = row + i * 4;
+        const unsigned alpha = ptr[3];
+        ptr[0] = div255(ptr[0] * alpha);
+        ptr[1] = div255(ptr[1] * alpha);
+        ptr[2] = div255(ptr[2] * alpha);
+      }
+    }
+
+    // 2x2 box filter of two source rows into `count` target pixels
+    void downsample_row(uint8_t *target, int count, const uint8_t *row0, const uint8_t *row1, int source_width) {
+      int i = 0;
+
+#if defined(GAMMA_HAS_SSE2)
+      const __m128i zero = _mm_setzero_si128();
+      const __m128i rounding = _mm_set1_epi16(2);
+
+      for (; i + 2 <= count && 2 * i + 4 <= source_width; i += 2) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + i * 8));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + i * 8));
+        __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+        __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+        // add the horizontal neighbours: pixels 0+1 and 2+3
+        __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+        sum = _mm_srli_epi16(_mm_add_epi16(sum, rounding), 2);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(target + i * 4), _mm_packus_epi16(sum, zero));
+      }
+#endif
+
+      for (; i < count; ++i) {
+        const int x0 = std::min(2 * i, source_width - 1) * 4;
+        const int x1 = std::min(2 * i + 1, source_width - 1) * 4;
+
+        for (int c = 0; c < 4; ++c) {
+          target[i * 4 + c] = static_cast<uint8_t>((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+        }
+      }
+    }
+
+  }
+
+  void Image::apply_color_matrix(const float matrix[4][5]) {
+    parallel_for(height, BandGrain, [&](int begin, int end) {
+      for (int y = begin; y < end; ++y) {
+        color_matrix_row(pixels + static_cast<std::size_t>(y) * width * 4, width, matrix);
+      }
+    });
+
+    mark_all_dirty();
+  }
+
+  void Image::adjust_hsv(float hue, float saturation, float value) {
+    parallel_for(height, BandGrain, [&](int begin, int end) {
+      // art often has runs of the same color, reuse the previous conversion
+      uint32_t previous_source = 0;
+      uint32_t previous_target = 0;
+      bool has_previous = false;
+
+      for (int y = begin; y < end; ++y) {
+        uint8_t *row = pixels + static_cast<std::size_t>(y) * width * 4;
+
+        for (int x = 0; x < width; ++x) {
+          uint8_t *ptr = row + x * 4;
+          uint32_t source;
+          std::memcpy(&source, ptr, sizeof(source));
+
+          if (!has_previous || source != previous_source) {
+            Color color = { ptr[0] / 255.0f, ptr[1] / 255.0f, ptr[2] / 255.0f, ptr[3] / 255.0f };
+            HSV hsv = convert_rgb_to_hsv(color);
+
+            hsv.h = std::fmod(hsv.h + hue, 360.0f);
+
+            if (hsv.h < 0.0f) {
+              hsv.h += 360.0f;
+            }
+
+            if (hsv.h >= 360.0f) {
+              hsv.h = 0.0f;
+            }
+
+            hsv.s = std::clamp(hsv.s * saturation, 0.0f, 1.0f);
+            hsv.v = std::clamp(hsv.v * value, 0.0f, 1.0f);
+
+            previous_source = source;
+            previous_target = to_rgba32(convert_hsv_to_rgb(hsv));
+            has_previous = true;
+          }
+
+          std::memcpy(ptr, &previous_target, sizeof(previous_target));
+        }
+      }
+    });
+
+    mark_all_dirty();
+  }
+
+  void Image::blur(float sigma) {
+    if (sigma <= 0.0f || !loaded()) {
+      return;
+    }
+
+    const int radius = static_cast<int>(std::ceil(3.0f * sigma));
+    std::vector<float> weights(2 * radius + 1);
+    float total = 0.0f;
+
+    for (int k = -radius; k <= radius; ++k) {
+      float weight = std::exp(- static_cast<float>(k * k) / (2.0f * sigma * sigma));
+      weights[k + radius] = weight;
+      total += weight;
+    }
+
+    for (auto & weight : weights) {
+      weight /= total;
+    }
+
+    const std::size_t stride = static_cast<std::size_t>(width) * 4;
+    // the intermediate buffer keeps full precision, rounding happens only once after the vertical pass
+    std::vector<float> horizontal(stride * height);
+
+    // horizontal pass, from the image to the intermediate buffer
+
+    parallel_for(height, BandGrain, [&](int begin, int end) {
+      for (int y = begin; y < end; ++y) {
+        const uint8_t *source = pixels + y * stride;
+        float *target = horizontal.data() + y * stride;
+
+        for (int x = 0; x < width; ++x) {
+          PixelF accumulator = zero_pixel();
+
+          for (int k = -radius; k <= radius; ++k) {
+            const int xk = std::clamp(x + k, 0, width - 1);
+            accumulator = multiply_add(accumulator, load_pixel(source + xk * 4), weights[k + radius]);
+          }
+
+          store_float_pixel(target + x * 4, accumulator);
+        }
+      }
+    });
+
+    // vertical pass, from the intermediate buffer back to the image
+
+    parallel_for(height, BandGrain, [&](int begin, int end) {
+      std::vector<const float *> rows(weights.size());
+
+      for (int y = begin; y < end; ++y) {
+        for (int k = -radius; k <= radius; ++k) {
+          rows[k + radius] = horizontal.data() + std::clamp(y + k, 0, height - 1) * stride;
+        }
+
+        uint8_t *target = pixels + y * stride;
+
+        for (int x = 0; x < width; ++x) {
+          PixelF accumulator = zero_pixel();
+
+          for (std::size_t k = 0; k < weights.size(); ++k) {
+            accumulator = multiply_add(accumulator, load_float_pixel(rows[k] + x * 4), weights[k]);
+          }
+
+          store_pixel(target + x * 4, accumulator);
+        }
+      }
+    });
+
+    mark_all_dirty();
+  }
+
+  void Image::premultiply() {
+    parallel_for(height, BandGrain, [&](int begin, int end) {
+      for (int y = begin; y < end; ++y) {
+        premultiply_row(pixels + static_cast<std::size_t>(y) * width * 4, width);
+      }
+    });
+
+    mark_all_dirty();
+  }
+
+  Image Image::downsample() const {
+    Image result(vec(std::max(width / 2, 1), std::max(height / 2, 1)));
+
+    if (result.pixels == nullptr) {
+      return result;
+    }
+
+    const std::size_t stride = static_cast<std::size_t>(width) * 4;
+
+    parallel_for(result.height, BandGrain, [&](int begin, int end) {
+      for (int y = begin; y < end; ++y) {
+        const uint8_t *row0 = pixels + std::min(2 * y, height - 1) * stride;
+        const uint8_t *row1 = pixels + std::min(2 * y + 1, height - 1) * stride;
+        downsample_row(result.pixels + static_cast<std::size_t>(y) * result.width * 4, result.width, row0, row1, width);
+      }
+    });
+
+    return result;
   }
 
   struct ImageApi : ImageClass {
@@ -70,351 +797,1967 @@ namespace gma {
 
       const char *filename = nullptr;
 
-      if (!agateCheck(vm, 1, filename)) {
-        agateError(vm, "String parameter expected for `filename`.");
+      if (!agateCheck(vm, 1, filename)) {
+        agateError(vm, "String parameter expected for `filename`.");
+        return;
+      }
+
+      *image = Image(filename);
+
+      if (!image->loaded()) {
+        agateError(vm, "Unable to load image: '%s'.", filename);
+        return;
+      }
+    }
+
+    static void new1(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      Vec2I size;
+
+      if (!agateCheck(vm, 1, size)) {
+        agateError(vm, "Vec2I parameter expected for `size`.");
+        return;
+      }
+
+      if (size.x <= 0 || size.y <= 0) {
+        agateError(vm, "Positive size expected for `size`.");
+        return;
+      }
+
+      *image = Image(size);
+    }
+
+    static void get_size(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      auto result = agateSlotNew<Vec2IClass>(vm, AGATE_RETURN_SLOT);
+      result->x = image->width;
+      result->y = image->height;
+    }
+
+    static void subscript_getter1(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      Vec2I position;
+
+      if (!agateCheck(vm, 1, position)) {
+        agateError(vm, "Vec2I parameter expected for `position`.");
+        return;
+      }
+
+      auto result = agateSlotNew<ColorClass>(vm, AGATE_RETURN_SLOT);
+      *result = image->get_color(position);
+    }
+
+    static void subscript_getter2(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      Vec2I position;
+
+      if (!agateCheck(vm, 1, position.x)) {
+        agateError(vm, "Int parameter expected for `x`.");
+        return;
+      }
+
+      if (!agateCheck(vm, 2, position.y)) {
+        agateError(vm, "Int parameter expected for `y`.");
+        return;
+      }
+
+      auto result = agateSlotNew<ColorClass>(vm, AGATE_RETURN_SLOT);
+      *result = image->get_color(position);
+    }
+
+    static void subscript_setter1(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      Vec2I position;
+
+      if (!agateCheck(vm, 1, position)) {
+        agateError(vm, "Vec2I parameter expected for `position`.");
+        return;
+      }
+
+      Color color;
+
+      if (!agateCheck(vm, 2, color)) {
+        agateError(vm, "Color parameter expected for `color`.");
+        return;
+      }
+
+      image->set_color(position, color);
+      agateSlotCopy(vm, AGATE_RETURN_SLOT, 2);
+    }
+
+    static void subscript_setter2(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      Vec2I position;
+
+      if (!agateCheck(vm, 1, position.x)) {
+        agateError(vm, "Int parameter expected for `x`.");
+        return;
+      }
+
+      if (!agateCheck(vm, 2, position.y)) {
+        agateError(vm, "Int parameter expected for `y`.");
+        return;
+      }
+
+      Color color;
+
+      if (!agateCheck(vm, 3, color)) {
+        agateError(vm, "Color parameter expected for `color`.");
+        return;
+      }
+
+      image->set_color(position, color);
+      agateSlotCopy(vm, AGATE_RETURN_SLOT, 3);
+    }
+
+    static void fill1(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      Color color;
+
+      if (!agateCheck(vm, 1, color)) {
+        agateError(vm, "Color parameter expected for `color`.");
+        return;
+      }
+
+      image->fill({ { 0, 0 }, { image->width, image->height } }, color);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void fill2(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      RectI rect;
+
+      if (!agateCheck(vm, 1, rect)) {
+        agateError(vm, "RectI parameter expected for `rect`.");
+        return;
+      }
+
+      Color color;
+
+      if (!agateCheck(vm, 2, color)) {
+        agateError(vm, "Color parameter expected for `color`.");
+        return;
+      }
+
+      image->fill(rect, color);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    // source, [source_rect,] position
+    static bool check_transfer(AgateVM *vm, int arity, const Image*& source, RectI& source_rect, Vec2I& position) {
+      if (!agateCheckTag<ImageClass>(vm, 1)) {
+        agateError(vm, "Image parameter expected for `source`.");
+        return false;
+      }
+
+      source = agateSlotGet<ImageClass>(vm, 1);
+      source_rect = { { 0, 0 }, { source->width, source->height } };
+
+      if (arity == 3 && !agateCheck(vm, 2, source_rect)) {
+        agateError(vm, "RectI parameter expected for `source_rect`.");
+        return false;
+      }
+
+      if (!agateCheck(vm, arity, position)) {
+        agateError(vm, "Vec2I parameter expected for `position`.");
+        return false;
+      }
+
+      return true;
+    }
+
+    template<int Arity>
+    static void copy(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      const Image *source = nullptr;
+      RectI source_rect;
+      Vec2I position;
+
+      if (!check_transfer(vm, Arity, source, source_rect, position)) {
+        return;
+      }
+
+      image->copy(*source, source_rect, position);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    template<int Arity>
+    static void blend(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      const Image *source = nullptr;
+      RectI source_rect;
+      Vec2I position;
+
+      if (!check_transfer(vm, Arity, source, source_rect, position)) {
+        return;
+      }
+
+      image->blend(*source, source_rect, position);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void apply_lut(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      if (agateSlotType(vm, 1) != AGATE_TYPE_STRING) {
+        agateError(vm, "String parameter expected for `lut`.");
+        return;
+      }
+
+      ptrdiff_t size = 0;
+      auto data = reinterpret_cast<const uint8_t *>(agateSlotGetStringSize(vm, 1, &size));
+
+      uint8_t lut[4][256];
+
+      if (size == 256) {
+        // same table for red, green and blue, alpha is unchanged
+        for (int i = 0; i < 256; ++i) {
+          lut[0][i] = lut[1][i] = lut[2][i] = data[i];
+          lut[3][i] = static_cast<uint8_t>(i);
+        }
+      } else if (size == 4 * 256) {
+        std::memcpy(lut, data, sizeof(lut));
+      } else {
+        agateError(vm, "String of 256 or 1024 bytes expected for `lut`.");
+        return;
+      }
+
+      image->apply_lut(lut);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void apply_color_matrix(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      if (agateSlotType(vm, 1) != AGATE_TYPE_ARRAY || agateSlotArraySize(vm, 1) != 20) {
+        agateError(vm, "Array of 20 numbers expected for `matrix`.");
+        return;
+      }
+
+      float matrix[4][5];
+      ptrdiff_t element_slot = agateSlotAllocate(vm);
+
+      for (int i = 0; i < 20; ++i) {
+        agateSlotArrayGet(vm, 1, i, element_slot);
+
+        if (!agateCheck(vm, element_slot, matrix[i / 5][i % 5])) {
+          agateError(vm, "Array of 20 numbers expected for `matrix`.");
+          return;
+        }
+      }
+
+      image->apply_color_matrix(matrix);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void adjust_hsv(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      float hue;
+
+      if (!agateCheck(vm, 1, hue)) {
+        agateError(vm, "Float parameter expected for `hue`.");
+        return;
+      }
+
+      float saturation;
+
+      if (!agateCheck(vm, 2, saturation)) {
+        agateError(vm, "Float parameter expected for `saturation`.");
+        return;
+      }
+
+      float value;
+
+      if (!agateCheck(vm, 3, value)) {
+        agateError(vm, "Float parameter expected for `value`.");
+        return;
+      }
+
+      image->adjust_hsv(hue, saturation, value);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void blur(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      float sigma;
+
+      if (!agateCheck(vm, 1, sigma)) {
+        agateError(vm, "Float parameter expected for `sigma`.");
+        return;
+      }
+
+      image->blur(sigma);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void premultiply(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+      image->premultiply();
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void downsample(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      auto result = agateSlotNew<ImageClass>(vm, AGATE_RETURN_SLOT);
+      *result = image->downsample();
+    }
+
+    static void read_rows(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      int y;
+
+      if (!agateCheck(vm, 1, y)) {
+        agateError(vm, "Int parameter expected for `y`.");
+        return;
+      }
+
+      int count;
+
+      if (!agateCheck(vm, 2, count)) {
+        agateError(vm, "Int parameter expected for `count`.");
+        return;
+      }
+
+      if (y < 0 || count < 0 || y + count > image->height) {
+        agateError(vm, "Rows out of the image.");
+        return;
+      }
+
+      std::vector<uint8_t> data(static_cast<std::size_t>(image->width) * count * 4);
+      image->read_rows(y, count, data.data());
+      agateSlotSetStringSize(vm, AGATE_RETURN_SLOT, reinterpret_cast<const char *>(data.data()), static_cast<ptrdiff_t>(data.size()));
+    }
+
+    static void write_rows(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      int y;
+
+      if (!agateCheck(vm, 1, y)) {
+        agateError(vm, "Int parameter expected for `y`.");
+        return;
+      }
+
+      if (agateSlotType(vm, 2) != AGATE_TYPE_STRING) {
+        agateError(vm, "String parameter expected for `data`.");
+        return;
+      }
+
+      ptrdiff_t size = 0;
+      auto data = reinterpret_cast<const uint8_t *>(agateSlotGetStringSize(vm, 2, &size));
+      const ptrdiff_t stride = static_cast<ptrdiff_t>(image->width) * 4;
+
+      if (size % stride != 0) {
+        agateError(vm, "Whole RGBA rows expected for `data`.");
+        return;
+      }
+
+      int count = static_cast<int>(size / stride);
+
+      if (y < 0 || y + count > image->height) {
+        agateError(vm, "Rows out of the image.");
+        return;
+      }
+
+      image->write_rows(y, count, data);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void save(AgateVM *vm) {
+      assert(agateCheckTag<ImageClass>(vm, 0));
+      auto image = agateSlotGet<ImageClass>(vm, 0);
+
+      const char *filename = nullptr;
+
+      if (!agateCheck(vm, 1, filename)) {
+        agateError(vm, "String parameter expected for `filename`.");
+        return;
+      }
+
+      if (!image->save(filename)) {
+        agateError(vm, "Unable to save image: '%s'.", filename);
+        return;
+      }
+
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+
+  };
+
+  static constexpr std::size_t StreamedUploadThreshold = 256 * 1024;
+  static constexpr GLuint64 SyncTimeout = 1000000000; // 1s
+
+  /*
+   * Texture formats
+   */
+
+  std::size_t compute_pixel_size(TextureFormat format) {
+    switch (format) {
+      case TextureFormat::RGBA8:
+        return 4;
+      case TextureFormat::RGB8:
+        return 3;
+      case TextureFormat::RGB565:
+      case TextureFormat::RGBA4444:
+      case TextureFormat::RG8:
+        return 2;
+      case TextureFormat::R8:
+        return 1;
+    }
+
+    assert(false);
+    return 4;
+  }
+
+  namespace {
+
+    struct TextureFormatInfo {
+      GLint internal_format;
+      GLenum format;
+      GLenum type;
+      GLint alignment;
+    };
+
+    TextureFormatInfo get_format_info(TextureFormat format) {
+      switch (format) {
+        case TextureFormat::RGBA8:
+          return { GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4 };
+        case TextureFormat::RGB8:
+          return { GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE, 1 };
+        case TextureFormat::RGB565:
+          // GL_RGB565 is not in core 3.3, drivers store GL_RGB5 in 16 bits
+          return { GL_RGB5, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, 2 };
+        case TextureFormat::RGBA4444:
+          return { GL_RGBA4, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, 2 };
+        case TextureFormat::RG8:
+          return { GL_RG8, GL_RG, GL_UNSIGNED_BYTE, 2 };
+        case TextureFormat::R8:
+          return { GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1 };
+      }
+
+      assert(false);
+      return { GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4 };
+    }
+
+    // exact rounded conversions of a 8 bits channel to 4, 5 and 6 bits
+    uint16_t to_4_bits(unsigned value) {
+      return static_cast<uint16_t>((value * 15 + 135) >> 8);
+    }
+
+    uint16_t to_5_bits(unsigned value) {
+      return static_cast<uint16_t>((value * 249 + 1014) >> 11);
+    }
+
+    uint16_t to_6_bits(unsigned value) {
+      return static_cast<uint16_t>((value * 253 + 505) >> 10);
+    }
+
+#if defined(GAMMA_HAS_SSE2)
+    // channel of 4 RGBA pixels in the 32 bits lanes
+    __m128i extract_channel(__m128i pixels, int channel) {
+      return _mm_and_si128(_mm_srli_epi32(pixels, channel * 8), _mm_set1_epi32(0xFF));
+    }
+
+    // same as the scalar conversions, the products fit in the low 16 bits of the lanes
+    __m128i round_channel(__m128i channel, int factor, int bias, int shift) {
+      return _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(channel, _mm_set1_epi32(factor)), _mm_set1_epi32(bias)), shift);
+    }
+
+    // pack the low 16 bits of the 32 bits lanes, without the signed saturation of _mm_packs_epi32
+    __m128i pack_low_16(__m128i lo, __m128i hi) {
+      lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+      hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+      return _mm_packs_epi32(lo, hi);
+    }
+#endif
+
+    void convert_to_rgb8(const uint8_t *source, uint8_t *target, int count) {
+      int i = 0;
+
+#if defined(GAMMA_HAS_SSSE3)
+      const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+      for (; i + 4 <= count; i += 4) {
+        __m128i pixels = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4)), shuffle);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(target + i * 3), pixels);
+        const int last = _mm_cvtsi128_si32(_mm_srli_si128(pixels, 8));
+        std::memcpy(target + i * 3 + 8, &last, 4);
+      }
+#endif
+
+      for (; i < count; ++i) {
+        std::memcpy(target + i * 3, source + i * 4, 3);
+      }
+    }
+
+    void convert_to_rgb565(const uint8_t *source, uint8_t *target, int count) {
+      int i = 0;
+
+#if defined(GAMMA_HAS_SSE2)
+      auto convert_pixels = [](__m128i pixels) {
+        __m128i r = round_channel(extract_channel(pixels, 0), 249, 1014, 11);
+        __m128i g = round_channel(extract_channel(pixels, 1), 253, 505, 10);
+        __m128i b = round_channel(extract_channel(pixels, 2), 249, 1014, 11);
+        return _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 11), _mm_slli_epi32(g, 5)), b);
+      };
+
+      for (; i + 8 <= count; i += 8) {
+        __m128i lo = convert_pixels(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4)));
+        __m128i hi = convert_pixels(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4 + 16)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(target + i * 2), pack_low_16(lo, hi));
+      }
+#endif
+
+      for (; i < count; ++i) {
+        const uint8_t *ptr = source + i * 4;
+        const uint16_t value = (to_5_bits(ptr[0]) << 11) | (to_6_bits(ptr[1]) << 5) | to_5_bits(ptr[2]);
+        std::memcpy(target + i * 2, &value, 2);
+      }
+    }
+
+    void convert_to_rgba4444(const uint8_t *source, uint8_t *target, int count) {
+      int i = 0;
+
+#if defined(GAMMA_HAS_SSE2)
+      auto convert_pixels = [](__m128i pixels) {
+        __m128i r = round_channel(extract_channel(pixels, 0), 15, 135, 8);
+        __m128i g = round_channel(extract_channel(pixels, 1), 15, 135, 8);
+        __m128i b = round_channel(extract_channel(pixels, 2), 15, 135, 8);
+        __m128i a = round_channel(_mm_srli_epi32(pixels, 24), 15, 135, 8);
+        return _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 12), _mm_slli_epi32(g, 8)), _mm_or_si128(_mm_slli_epi32(b, 4), a));
+      };
+
+      for (; i + 8 <= count; i += 8) {
+        __m128i lo = convert_pixels(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4)));
+        __m128i hi = convert_pixels(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4 + 16)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(target + i * 2), pack_low_16(lo, hi));
+      }
+#endif
+
+      for (; i < count; ++i) {
+        const uint8_t *ptr = source + i * 4;
+        const uint16_t value = (to_4_bits(ptr[0]) << 12) | (to_4_bits(ptr[1]) << 8) | (to_4_bits(ptr[2]) << 4) | to_4_bits(ptr[3]);
+        std::memcpy(target + i * 2, &value, 2);
+      }
+    }
+
+    void convert_to_rg8(const uint8_t *source, uint8_t *target, int count) {
+      int i = 0;
+
+#if defined(GAMMA_HAS_SSE2)
+      for (; i + 8 <= count; i += 8) {
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4 + 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(target + i * 2), pack_low_16(lo, hi));
+      }
+#endif
+
+      for (; i < count; ++i) {
+        std::memcpy(target + i * 2, source + i * 4, 2);
+      }
+    }
+
+    void convert_to_r8(const uint8_t *source, uint8_t *target, int count) {
+      int i = 0;
+
+#if defined(GAMMA_HAS_SSE2)
+      for (; i + 16 <= count; i += 16) {
+        __m128i a0 = _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4)), 24);
+        __m128i a1 = _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4 + 16)), 24);
+        __m128i a2 = _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4 + 32)), 24);
+        __m128i a3 = _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4 + 48)), 24);
+        __m128i alpha = _mm_packus_epi16(_mm_packs_epi32(a0, a1), _mm_packs_epi32(a2, a3));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(target + i), alpha);
+      }
+#endif
+
+      for (; i < count; ++i) {
+        target[i] = source[i * 4 + 3];
+      }
+    }
+
+    bool check_texture_format(AgateVM *vm, ptrdiff_t slot, TextureFormat& format) {
+      int64_t value;
+
+      if (!agateCheck(vm, slot, value) || value < 0 || value > static_cast<int64_t>(TextureFormat::R8)) {
+        return false;
+      }
+
+      format = static_cast<TextureFormat>(value);
+      return true;
+    }
+
+    // convert RGBA8 rows to the layout of the format, split across threads by row bands
+    void convert_rows(TextureFormat format, const uint8_t *source, std::size_t source_stride, uint8_t *target, int width, int rows) {
+      const std::size_t target_stride = static_cast<std::size_t>(width) * compute_pixel_size(format);
+
+      parallel_for(rows, BandGrain, [&](int begin, int end) {
+        for (int y = begin; y < end; ++y) {
+          const uint8_t *source_row = source + y * source_stride;
+          uint8_t *target_row = target + y * target_stride;
+
+          switch (format) {
+            case TextureFormat::RGBA8:
+              std::memcpy(target_row, source_row, target_stride);
+              break;
+            case TextureFormat::RGB8:
+              convert_to_rgb8(source_row, target_row, width);
+              break;
+            case TextureFormat::RGB565:
+              convert_to_rgb565(source_row, target_row, width);
+              break;
+            case TextureFormat::RGBA4444:
+              convert_to_rgba4444(source_row, target_row, width);
+              break;
+            case TextureFormat::RG8:
+              convert_to_rg8(source_row, target_row, width);
+              break;
+            case TextureFormat::R8:
+              convert_to_r8(source_row, target_row, width);
+              break;
+          }
+        }
+      });
+    }
+
+  }
+
+  /*
+   * PixelUploader
+   */
+
+  void PixelUploader::create() {
+    GAMMA_GL_CHECK(glGenBuffers(BufferCount, buffers));
+
+    for (int i = 0; i < BufferCount; ++i) {
+      GAMMA_GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffers[i]));
+      GAMMA_GL_CHECK(glBufferData(GL_PIXEL_UNPACK_BUFFER, BufferSize, nullptr, GL_STREAM_DRAW));
+      fences[i] = nullptr;
+    }
+
+    GAMMA_GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+    current = 0;
+  }
+
+  void PixelUploader::destroy() {
+    if (!created()) {
+      return;
+    }
+
+    for (int i = 0; i < BufferCount; ++i) {
+      if (fences[i] != nullptr) {
+        GAMMA_GL_CHECK(glDeleteSync(fences[i]));
+        fences[i] = nullptr;
+      }
+    }
+
+    GAMMA_GL_CHECK(glDeleteBuffers(BufferCount, buffers));
+
+    for (auto & buffer : buffers) {
+      buffer = 0;
+    }
+  }
+
+  void PixelUploader::upload(GLuint texture, TextureFormat format, RectI region, const uint8_t *data, std::size_t stride) {
+    if (!created()) {
+      create();
+    }
+
+    const TextureFormatInfo info = get_format_info(format);
+    const std::size_t pixel_size = compute_pixel_size(format);
+    const std::size_t row_size = region.size.x * pixel_size;
+    const int tile_rows = static_cast<int>(std::max(BufferSize / row_size, std::size_t(1)));
+    assert(row_size <= BufferSize);
+
+    GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, texture));
+
+    for (int y = 0; y < region.size.y; y += tile_rows) {
+      const int rows = std::min(tile_rows, region.size.y - y);
+
+      // do not overwrite a buffer that the GPU may still read
+      if (fences[current] != nullptr) {
+        glClientWaitSync(fences[current], GL_SYNC_FLUSH_COMMANDS_BIT, SyncTimeout);
+        GAMMA_GL_CHECK(glDeleteSync(fences[current]));
+        fences[current] = nullptr;
+      }
+
+      GAMMA_GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffers[current]));
+      auto mapped = static_cast<uint8_t *>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, rows * row_size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+
+      if (mapped == nullptr) {
+        // fall back to client memory
+        GAMMA_GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+        GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(stride / pixel_size)));
+        GAMMA_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, region.position.x, region.position.y + y, region.size.x, rows, info.format, info.type, data + y * stride));
+        GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+        continue;
+      }
+
+      if (stride == row_size) {
+        std::memcpy(mapped, data + y * stride, rows * row_size);
+      } else {
+        for (int i = 0; i < rows; ++i) {
+          std::memcpy(mapped + i * row_size, data + (y + i) * stride, row_size);
+        }
+      }
+
+      GAMMA_GL_CHECK(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+      GAMMA_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, region.position.x, region.position.y + y, region.size.x, rows, info.format, info.type, nullptr));
+
+      fences[current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      current = (current + 1) % BufferCount;
+    }
+
+    GAMMA_GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+  }
+
+  PixelUploader& PixelUploader::get() {
+    static PixelUploader uploader = {};
+    return uploader;
+  }
+
+  /*
+   * Texture
+   */
+
+  Texture::Texture(TextureKind kind, GLsizei width, GLsizei height, const uint8_t *data)
+  : Texture(kind == TextureKind::COLOR ? TextureFormat::RGBA8 : TextureFormat::R8, width, height, data)
+  {
+  }
+
+  Texture::Texture(TextureFormat format, GLsizei width, GLsizei height, const uint8_t *data)
+  : kind(format == TextureFormat::R8 ? TextureKind::ALPHA : TextureKind::COLOR)
+  , format(format)
+  , id(0)
+  , width(width)
+  , height(height)
+  , flags(0)
+  , framebuffer(0)
+  {
+    GAMMA_GL_CHECK(glGenTextures(1, &id));
+
+    if (id == 0) {
+      return;
+    }
+
+    const TextureFormatInfo info = get_format_info(format);
+    std::size_t stride = static_cast<std::size_t>(width) * compute_pixel_size(format);
+
+    // big textures go through the pixel unpack buffers instead of client memory
+    bool streamed = data != nullptr && stride * height >= StreamedUploadThreshold;
+
+    GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, info.alignment));
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, id));
+    GAMMA_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, info.internal_format, width, height, 0, info.format, info.type, streamed ? nullptr : data));
+    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+
+    if (format == TextureFormat::R8) {
+      // a white mask, so that the texture works with both the color and the alpha shaders
+      const GLint swizzle[4] = { GL_ONE, GL_ONE, GL_ONE, GL_RED };
+      GAMMA_GL_CHECK(glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle));
+    }
+
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+
+    if (streamed) {
+      PixelUploader::get().upload(id, format, { { 0, 0 }, { width, height } }, data, stride);
+    }
+
+    TextureManager::get().add(*this);
+  }
+
+  Texture::Texture(TextureFormat format, const Image& image)
+  : Texture(format, image.width, image.height, nullptr)
+  {
+    update(image, { { 0, 0 }, { image.width, image.height } });
+  }
+
+  void Texture::destroy() {
+    TextureManager::get().remove(id);
+
+    if (framebuffer != 0) {
+      glDeleteFramebuffers(1, &framebuffer);
+      framebuffer = 0;
+    }
+
+    if (id != 0) {
+      glDeleteTextures(1, &id);
+      id = 0;
+    }
+
+    width = height = flags = 0;
+  }
+
+  GLenum Texture::compute_min_filter() const {
+    if (has_mipmap()) {
+      return is_smooth() ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR;
+    }
+
+    return is_smooth() ? GL_LINEAR : GL_NEAREST;
+  }
+
+  void Texture::resize(Vec2I size) {
+    width = size.x;
+    height = size.y;
+
+    TextureManager& manager = TextureManager::get();
+    manager.clear_source(id);
+
+    const TextureFormatInfo info = get_format_info(format);
+
+    GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, info.alignment));
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, id));
+    GAMMA_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, info.internal_format, width, height, 0, info.format, info.type, nullptr));
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+
+    manager.refresh(*this);
+  }
+
+  void Texture::make_renderable(Vec2I size) {
+    if (size.x != width || size.y != height) {
+      resize(size);
+    } else {
+      // the content of the texture is kept, and then modified by the rendering
+      TextureManager& manager = TextureManager::get();
+      manager.make_resident(id);
+      manager.clear_source(id);
+    }
+
+    if (framebuffer == 0) {
+      GAMMA_GL_CHECK(glGenFramebuffers(1, &framebuffer));
+      GAMMA_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, framebuffer));
+      GAMMA_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0));
+      assert(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+      TextureManager::get().refresh(*this);
+    } else {
+      GAMMA_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, framebuffer));
+    }
+  }
+
+  void Texture::update(const Image& image, RectI rect) {
+    assert(image.width == width && image.height == height);
+
+    rect = clip_rect(rect, image.width, image.height);
+
+    if (rect.size.x == 0 || rect.size.y == 0) {
+      return;
+    }
+
+    // the rest of the texture is kept, it must be resident
+    TextureManager& manager = TextureManager::get();
+    manager.make_resident(id);
+    manager.clear_source(id);
+
+    // the image rows are stored bottom up, like the texture
+    RectI region = { { rect.position.x, image.height - rect.position.y - rect.size.y }, rect.size };
+    const std::size_t stride = static_cast<std::size_t>(image.width) * 4;
+    const uint8_t *data = image.pixels + region.position.y * stride + region.position.x * 4;
+
+    if (format != TextureFormat::RGBA8) {
+      // convert the region in tightly packed rows
+      std::vector<uint8_t> converted(static_cast<std::size_t>(region.size.x) * region.size.y * compute_pixel_size(format));
+      convert_rows(format, data, stride, converted.data(), region.size.x, region.size.y);
+
+      const std::size_t converted_stride = static_cast<std::size_t>(region.size.x) * compute_pixel_size(format);
+
+      if (converted.size() >= StreamedUploadThreshold) {
+        PixelUploader::get().upload(id, format, region, converted.data(), converted_stride);
+        return;
+      }
+
+      const TextureFormatInfo info = get_format_info(format);
+
+      GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+      GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, id));
+      GAMMA_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, region.position.x, region.position.y, region.size.x, region.size.y, info.format, info.type, converted.data()));
+      GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+      return;
+    }
+
+    if (stride * region.size.y >= StreamedUploadThreshold) {
+      PixelUploader::get().upload(id, format, region, data, stride);
+      return;
+    }
+
+    // upload the sub-rectangle in place, the row length skips the rest of the image rows
+    GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+    GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ROW_LENGTH, image.width));
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, id));
+    GAMMA_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, region.position.x, region.position.y, region.size.x, region.size.y, GL_RGBA, GL_UNSIGNED_BYTE, data));
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+    GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+  }
+
+  struct TextureApi : TextureClass {
+
+    static void destroy(AgateVM *vm, const char *unit_name, const char *class_name, void *data) {
+      auto texture = static_cast<Texture *>(data);
+      texture->destroy();
+    }
+
+    static void generic_new(AgateVM *vm, TextureFormat format) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+
+      Vec2I size;
+
+      if (!agateCheck(vm, 1, size)) {
+        agateError(vm, "Vec2I parameter expected for `value`.");
+        return;
+      }
+
+      new (texture) Texture(format, size.x, size.y, nullptr);
+    }
+
+    static void new1(AgateVM *vm) {
+      generic_new(vm, TextureFormat::RGBA8);
+    }
+
+    static void new2(AgateVM *vm) {
+      TextureFormat format;
+
+      if (!check_texture_format(vm, 2, format)) {
+        agateError(vm, "TextureFormat parameter expected for `format`.");
+        return;
+      }
+
+      generic_new(vm, format);
+    }
+
+    static void generic_from_file(AgateVM *vm, TextureFormat format) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+
+      const char *filename = nullptr;
+
+      if (!agateCheck(vm, 1, filename)) {
+        agateError(vm, "String parameter expected for `filename`.");
+        return;
+      }
+
+      TextureManager& manager = TextureManager::get();
+
+      if (manager.budget > 0) {
+        // only the header is read here, the pixels are loaded when the texture is first used
+        int width = 0;
+        int height = 0;
+
+        if (!Image::read_size(filename, width, height)) {
+          agateError(vm, "Unable to load texture: '%s'.", filename);
+          return;
+        }
+
+        new (texture) Texture(format, width, height, nullptr);
+        manager.defer(texture->id, filename);
+        return;
+      }
+
+      Image image(filename);
+
+      if (!image.loaded()) {
+        agateError(vm, "Unable to load texture: '%s'.", filename);
+        return;
+      }
+
+      if (format == TextureFormat::RGBA8) {
+        new (texture) Texture(TextureKind::COLOR, image.width, image.height, image.pixels);
+      } else {
+        new (texture) Texture(format, image);
+      }
+
+      image.destroy();
+      manager.set_source(texture->id, filename);
+    }
+
+    static void from_file1(AgateVM *vm) {
+      generic_from_file(vm, TextureFormat::RGBA8);
+    }
+
+    static void from_file2(AgateVM *vm) {
+      TextureFormat format;
+
+      if (!check_texture_format(vm, 2, format)) {
+        agateError(vm, "TextureFormat parameter expected for `format`.");
+        return;
+      }
+
+      generic_from_file(vm, format);
+    }
+
+    static void generic_from_image(AgateVM *vm, TextureFormat format) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+
+      if (!agateCheckTag<ImageClass>(vm, 1)) {
+        agateError(vm, "Image parameter expected for `image`.");
+        return;
+      }
+
+      auto image = agateSlotGet<ImageClass>(vm, 1);
+
+      if (format == TextureFormat::RGBA8) {
+        new (texture) Texture(TextureKind::COLOR, image->width, image->height, image->pixels);
+      } else {
+        new (texture) Texture(format, *image);
+      }
+
+      image->dirty = { { 0, 0 }, { 0, 0 } };
+    }
+
+    static void from_image1(AgateVM *vm) {
+      generic_from_image(vm, TextureFormat::RGBA8);
+    }
+
+    static void from_image2(AgateVM *vm) {
+      TextureFormat format;
+
+      if (!check_texture_format(vm, 2, format)) {
+        agateError(vm, "TextureFormat parameter expected for `format`.");
+        return;
+      }
+
+      generic_from_image(vm, format);
+    }
+
+    static Image *check_update_image(AgateVM *vm, Texture *texture) {
+      if (!agateCheckTag<ImageClass>(vm, 1)) {
+        agateError(vm, "Image parameter expected for `image`.");
+        return nullptr;
+      }
+
+      auto image = agateSlotGet<ImageClass>(vm, 1);
+
+      if (image->width != texture->width || image->height != texture->height) {
+        agateError(vm, "Image and texture sizes differ.");
+        return nullptr;
+      }
+
+      return image;
+    }
+
+    static void update1(AgateVM *vm) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+
+      auto image = check_update_image(vm, texture);
+
+      if (image == nullptr) {
+        return;
+      }
+
+      // only the region modified since the last update
+      if (image->is_dirty()) {
+        texture->update(*image, image->dirty);
+        image->dirty = { { 0, 0 }, { 0, 0 } };
+      }
+
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void update2(AgateVM *vm) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+
+      auto image = check_update_image(vm, texture);
+
+      if (image == nullptr) {
+        return;
+      }
+
+      RectI rect;
+
+      if (!agateCheck(vm, 2, rect)) {
+        agateError(vm, "RectI parameter expected for `rect`.");
+        return;
+      }
+
+      texture->update(*image, rect);
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
+    }
+
+    static void get_size(AgateVM *vm) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+
+      auto result = agateSlotNew<Vec2IClass>(vm, AGATE_RETURN_SLOT);
+      result->x = texture->width;
+      result->y = texture->height;
+    }
+
+    static void set_size(AgateVM *vm) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+
+      Vec2I size;
+
+      if (!agateCheck(vm, 1, size)) {
+        agateError(vm, "Vec2I parameter expected for `value`.");
+        return;
+      }
+
+      texture->resize(size);
+    }
+
+    static void get_format(AgateVM *vm) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(texture->format));
+    }
+
+    static void is_smooth(AgateVM *vm) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+      agateSlotSetBool(vm, AGATE_RETURN_SLOT, texture->is_smooth());
+    }
+
+    static void set_smooth(AgateVM *vm) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+
+      bool smooth;
+
+      if (!agateCheck(vm, 1, smooth)) {
+        agateError(vm, "Bool parameter expected for `value`.");
+        return;
+      }
+
+      if (smooth == texture->is_smooth()) {
+        return;
+      }
+
+      if (smooth) {
+        texture->flags |= TEXTURE_SMOOTH;
+      } else {
+        texture->flags &= ~TEXTURE_SMOOTH;
+      }
+
+      glBindTexture(GL_TEXTURE_2D, texture->id);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, texture->compute_min_filter());
+      glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    static void is_repeated(AgateVM *vm) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+      agateSlotSetBool(vm, AGATE_RETURN_SLOT, texture->is_repeated());
+    }
+
+    static void set_repeated(AgateVM *vm) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+
+      bool repeated;
+
+      if (!agateCheck(vm, 1, repeated)) {
+        agateError(vm, "Bool parameter expected for `value`.");
+        return;
+      }
+
+      if (repeated == texture->is_repeated()) {
+        return;
+      }
+
+      if (repeated) {
+        texture->flags |= TEXTURE_REPEATED;
+      } else {
+        texture->flags &= ~TEXTURE_REPEATED;
+      }
+
+      glBindTexture(GL_TEXTURE_2D, texture->id);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, repeated ? GL_REPEAT : GL_CLAMP_TO_EDGE);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, repeated ? GL_REPEAT : GL_CLAMP_TO_EDGE);
+      glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    static void generate_mipmap(AgateVM *vm) {
+      assert(agateCheckTag<TextureClass>(vm, 0));
+      auto texture = agateSlotGet<TextureClass>(vm, 0);
+
+      if (texture->has_mipmap()) {
+        return;
+      }
+
+      texture->flags |= TEXTURE_MIPMAP;
+
+      glBindTexture(GL_TEXTURE_2D, texture->id);
+      glGenerateMipmap(GL_TEXTURE_2D);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, texture->compute_min_filter());
+      glBindTexture(GL_TEXTURE_2D, 0);
+
+      TextureManager::get().refresh(*texture);
+
+    }
+
+  };
+
+  /*
+   * TextureFormat
+   */
+
+// NAME, FORMAT
+#define GAMMA_TEXTURE_FORMAT_LIST \
+  X(RGBA8,    TextureFormat::RGBA8)     \
+  X(RGB8,     TextureFormat::RGB8)      \
+  X(RGB565,   TextureFormat::RGB565)    \
+  X(RGBA4444, TextureFormat::RGBA4444)  \
+  X(RG8,      TextureFormat::RG8)       \
+  X(R8,       TextureFormat::R8)
+
+  struct TextureFormatApi : TextureFormatClass {
+    #define X(name, format)                                                     \
+    static void name(AgateVM *vm) {                                             \
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(format));   \
+    }
+
+    GAMMA_TEXTURE_FORMAT_LIST
+
+    #undef X
+  };
+
+  /*
+   * TextureManager
+   */
+
+  namespace {
+
+    std::size_t compute_texture_size(GLsizei width, GLsizei height, TextureFormat format, bool mipmap) {
+      const std::size_t pixel_size = compute_pixel_size(format);
+      std::size_t size = static_cast<std::size_t>(width) * height * pixel_size;
+
+      if (mipmap) {
+        while (width > 1 || height > 1) {
+          width = std::max(width / 2, 1);
+          height = std::max(height / 2, 1);
+          size += static_cast<std::size_t>(width) * height * pixel_size;
+        }
+      }
+
+      return size;
+    }
+
+    // the source of a texture in the layout of its format, `data` points into `image` or `converted`
+    bool load_texture_source(const std::string& filename, TextureFormat format, GLsizei width, GLsizei height, Image& image, std::vector<uint8_t>& converted) {
+      image = Image(filename.c_str());
+
+      if (!image.loaded()) {
+        return false;
+      }
+
+      if (image.width != width || image.height != height) {
+        image.destroy();
+        return false;
+      }
+
+      if (format != TextureFormat::RGBA8) {
+        converted.resize(static_cast<std::size_t>(width) * height * compute_pixel_size(format));
+        convert_rows(format, image.pixels, static_cast<std::size_t>(width) * 4, converted.data(), width, height);
+        image.destroy();
+      }
+
+      return true;
+    }
+
+    struct TextureReload {
+      GLuint id;
+      uint64_t generation;
+      bool loaded;
+      Image image;
+      std::vector<uint8_t> converted;
+    };
+
+    // reloaded textures waiting for the render thread
+    std::mutex reload_mutex;
+    std::deque<TextureReload *> reload_queue;
+
+    constexpr uint8_t TexturePlaceholder[4] = { 0x00, 0x00, 0x00, 0x00 };
+
+  }
+
+  void TextureManager::add(const Texture& texture) {
+    remove(texture.id); // a previous texture with the same id that was not destroyed with Texture::destroy()
+
+    lru.push_front(texture.id);
+
+    Entry& entry = entries[texture.id];
+    entry.filename.clear();
+    entry.resident = true;
+    entry.loading = false;
+    entry.deferred = false;
+    entry.generation = ++generations;
+    entry.last_use = frame;
+    entry.position = lru.begin();
+    entry.size = 0;
+
+    refresh(texture);
+  }
+
+  void TextureManager::remove(GLuint id) {
+    auto iterator = entries.find(id);
+
+    if (iterator == entries.end()) {
+      return;
+    }
+
+    Entry& entry = iterator->second;
+
+    if (entry.resident) {
+      resident_size -= entry.size;
+    }
+
+    lru.erase(entry.position);
+    entries.erase(iterator);
+  }
+
+  void TextureManager::refresh(const Texture& texture) {
+    auto iterator = entries.find(texture.id);
+
+    if (iterator == entries.end()) {
+      return;
+    }
+
+    Entry& entry = iterator->second;
+
+    if (entry.resident) {
+      resident_size -= entry.size;
+    }
+
+    entry.width = texture.width;
+    entry.height = texture.height;
+    entry.format = texture.format;
+    entry.mipmap = texture.has_mipmap();
+    entry.renderable = texture.framebuffer != 0;
+    entry.size = compute_texture_size(entry.width, entry.height, entry.format, entry.mipmap);
+
+    if (entry.resident) {
+      resident_size += entry.size;
+    }
+  }
+
+  void TextureManager::set_source(GLuint id, const char *filename) {
+    if (auto iterator = entries.find(id); iterator != entries.end()) {
+      iterator->second.filename = filename;
+    }
+  }
+
+  void TextureManager::defer(GLuint id, const char *filename) {
+    auto iterator = entries.find(id);
+
+    if (iterator == entries.end()) {
+      return;
+    }
+
+    Entry& entry = iterator->second;
+    entry.filename = filename;
+    entry.deferred = true;
+
+    if (entry.resident) {
+      release(id, entry);
+    }
+  }
+
+  void TextureManager::clear_source(GLuint id) {
+    auto iterator = entries.find(id);
+
+    if (iterator == entries.end()) {
+      return;
+    }
+
+    Entry& entry = iterator->second;
+    entry.filename.clear();
+    entry.deferred = false;
+
+    if (!entry.resident) {
+      // the placeholder stays until the texture is specified again, the storage is counted as if it was
+      GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, id));
+      GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1000));
+      GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+
+      entry.resident = true;
+      entry.loading = false;
+      entry.generation = ++generations;
+      resident_size += entry.size;
+    }
+  }
+
+  void TextureManager::touch(GLuint id) {
+    auto iterator = entries.find(id);
+
+    if (iterator == entries.end()) {
+      return;
+    }
+
+    Entry& entry = iterator->second;
+    entry.last_use = frame;
+    lru.splice(lru.begin(), lru, entry.position);
+
+    if (entry.resident) {
+      ++hits;
+      return;
+    }
+
+    ++misses;
+
+    // the first load is synchronous, so that the first frames draw the texture and a replay gets the same frames
+    if (entry.deferred) {
+      make_resident(id);
+      return;
+    }
+
+    if (entry.loading) {
+      return;
+    }
+
+    entry.loading = true;
+
+    auto reload = new TextureReload;
+    reload->id = id;
+    reload->generation = entry.generation;
+    reload->loaded = false;
+    reload->image = Image();
+
+    WorkerPool::get().submit([reload, filename = entry.filename, format = entry.format, width = entry.width, height = entry.height]() {
+      reload->loaded = load_texture_source(filename, format, width, height, reload->image, reload->converted);
+
+      {
+        std::lock_guard<std::mutex> lock(reload_mutex);
+        reload_queue.push_back(reload);
+      }
+
+      sdl_wake();
+    });
+  }
+
+  void TextureManager::make_resident(GLuint id) {
+    auto iterator = entries.find(id);
+
+    if (iterator == entries.end() || iterator->second.resident) {
+      return;
+    }
+
+    Entry& entry = iterator->second;
+    entry.generation = ++generations; // a pending load is not needed anymore
+    entry.loading = false;
+
+    Image image;
+    std::vector<uint8_t> converted;
+
+    if (!load_texture_source(entry.filename, entry.format, entry.width, entry.height, image, converted)) {
+      // the source is gone or corrupt, keep the placeholder for good
+      std::fprintf(stderr, "Unable to load texture: '%s'.\n", entry.filename.c_str());
+      clear_source(id);
+      return;
+    }
+
+    upload(id, entry, converted.empty() ? image.pixels : converted.data());
+
+    if (image.loaded()) {
+      image.destroy();
+    }
+  }
+
+  void TextureManager::update() {
+    std::deque<TextureReload *> reloads;
+
+    {
+      std::lock_guard<std::mutex> lock(reload_mutex);
+      reloads.swap(reload_queue);
+    }
+
+    for (TextureReload *reload : reloads) {
+      auto iterator = entries.find(reload->id);
+
+      if (iterator != entries.end() && iterator->second.generation == reload->generation && iterator->second.loading) {
+        Entry& entry = iterator->second;
+
+        if (reload->loaded) {
+          upload(reload->id, entry, reload->converted.empty() ? reload->image.pixels : reload->converted.data());
+        } else {
+          // the source is gone, keep the placeholder for good
+          clear_source(reload->id);
+        }
+      }
+
+      if (reload->image.loaded()) {
+        reload->image.destroy();
+      }
+
+      delete reload;
+    }
+
+    if (budget > 0) {
+      // the textures used in this frame are kept, so that they are not loaded again in the next frame
+      for (auto iterator = lru.rbegin(); iterator != lru.rend() && resident_size > budget; ) {
+        GLuint id = *iterator++;
+        Entry& entry = entries[id];
+
+        if (entry.last_use == frame) {
+          break; // all the next ones are more recent
+        }
+
+        if (entry.resident && !entry.renderable && !entry.filename.empty()) {
+          evict(id, entry);
+        }
+      }
+    }
+
+    ++frame;
+  }
+
+  void TextureManager::evict(GLuint id, Entry& entry) {
+    release(id, entry);
+    ++evictions;
+  }
+
+  void TextureManager::release(GLuint id, Entry& entry) {
+    const TextureFormatInfo info = get_format_info(entry.format);
+
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, id));
+
+    if (entry.mipmap) {
+      // release the storage of the mipmaps
+      GLsizei width = entry.width;
+      GLsizei height = entry.height;
+
+      for (GLint level = 1; width > 1 || height > 1; ++level) {
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+        GAMMA_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, level, info.internal_format, 0, 0, 0, info.format, info.type, nullptr));
+      }
+    }
+
+    // a single level, so that the placeholder is complete for any filter
+    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0));
+    GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+    GAMMA_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, info.internal_format, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, TexturePlaceholder));
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+
+    entry.resident = false;
+    resident_size -= entry.size;
+  }
+
+  void TextureManager::upload(GLuint id, Entry& entry, const uint8_t *data) {
+    const TextureFormatInfo info = get_format_info(entry.format);
+
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, id));
+    GAMMA_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, info.internal_format, entry.width, entry.height, 0, info.format, info.type, nullptr));
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+
+    PixelUploader::get().upload(id, entry.format, { { 0, 0 }, { entry.width, entry.height } }, data, static_cast<std::size_t>(entry.width) * compute_pixel_size(entry.format));
+
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, id));
+    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1000));
+
+    if (entry.mipmap) {
+      GAMMA_GL_CHECK(glGenerateMipmap(GL_TEXTURE_2D));
+    }
+
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+
+    entry.resident = true;
+    entry.loading = false;
+    entry.deferred = false;
+    resident_size += entry.size;
+  }
+
+  TextureManager& TextureManager::get() {
+    static TextureManager manager;
+    return manager;
+  }
+
+  struct TextureManagerApi : TextureManagerClass {
+
+    static void get_budget(AgateVM *vm) {
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(TextureManager::get().budget));
+    }
+
+    static void set_budget(AgateVM *vm) {
+      int64_t budget;
+
+      if (!agateCheck(vm, 1, budget) || budget < 0) {
+        agateError(vm, "Positive Int parameter expected for `value`.");
         return;
       }
 
-      *image = Image(filename);
+      TextureManager::get().budget = static_cast<std::size_t>(budget);
+      agateSlotCopy(vm, AGATE_RETURN_SLOT, 1);
+    }
 
-      if (!image->loaded()) {
-        agateError(vm, "Unable to load image: '%s'.", filename);
-        return;
-      }
+    static void get_resident_size(AgateVM *vm) {
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(TextureManager::get().resident_size));
     }
 
-    static void subscript_getter1(AgateVM *vm) {
-      assert(agateCheckTag<ImageClass>(vm, 0));
-      auto image = agateSlotGet<ImageClass>(vm, 0);
+    static void get_hits(AgateVM *vm) {
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(TextureManager::get().hits));
+    }
 
-      Vec2I position;
+    static void get_misses(AgateVM *vm) {
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(TextureManager::get().misses));
+    }
 
-      if (!agateCheck(vm, 1, position)) {
-        agateError(vm, "Vec2I parameter expected for `position`.");
-        return;
-      }
+    static void get_evictions(AgateVM *vm) {
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(TextureManager::get().evictions));
+    }
 
-      auto result = agateSlotNew<ColorClass>(vm, AGATE_RETURN_SLOT);
-      *result = image->get_color(position);
+    static void reset_stats(AgateVM *vm) {
+      TextureManager::get().reset_stats();
+      agateSlotSetNil(vm, AGATE_RETURN_SLOT);
     }
 
-    static void subscript_getter2(AgateVM *vm) {
-      assert(agateCheckTag<ImageClass>(vm, 0));
-      auto image = agateSlotGet<ImageClass>(vm, 0);
+  };
 
-      Vec2I position;
+  /*
+   * Asynchronous loading
+   */
 
-      if (!agateCheck(vm, 1, position.x)) {
-        agateError(vm, "Int parameter expected for `x`.");
-        return;
-      }
+  enum class AsyncStatus {
+    PENDING,
+    DECODED, // textures only, waiting for the upload
+    READY,
+    FAILED,
+  };
 
-      if (!agateCheck(vm, 2, position.y)) {
-        agateError(vm, "Int parameter expected for `y`.");
-        return;
-      }
+  struct AsyncLoad {
+    std::string filename;
+    bool texture_wanted = false;
+    TextureFormat format = TextureFormat::RGBA8;
+    std::atomic<int> references = 1;
 
-      auto result = agateSlotNew<ColorClass>(vm, AGATE_RETURN_SLOT);
-      *result = image->get_color(position);
+    std::mutex mutex;
+    std::condition_variable condition;
+    AsyncStatus status = AsyncStatus::PENDING;
+
+    Image image = Image();
+    std::vector<uint8_t> converted; // the image in the texture format, if it is not RGBA8
+    Texture texture = Texture();
+
+    static AsyncLoad *start(const char *filename, bool texture_wanted, TextureFormat format);
+
+    void acquire() {
+      ++references;
     }
 
-    static void subscript_setter1(AgateVM *vm) {
-      assert(agateCheckTag<ImageClass>(vm, 0));
-      auto image = agateSlotGet<ImageClass>(vm, 0);
+    void release();
 
-      Vec2I position;
+    AsyncStatus get_status() {
+      std::lock_guard<std::mutex> lock(mutex);
+      return status;
+    }
 
-      if (!agateCheck(vm, 1, position)) {
-        agateError(vm, "Vec2I parameter expected for `position`.");
-        return;
-      }
+    int uploaded_rows = 0;
 
-      Color color;
+    AsyncStatus wait();
+    std::size_t stream(std::size_t budget);
+  };
 
-      if (!agateCheck(vm, 2, color)) {
-        agateError(vm, "Color parameter expected for `color`.");
-        return;
-      }
+  // decoded textures waiting for the render thread
+  static std::mutex upload_mutex;
+  static std::deque<AsyncLoad *> upload_queue;
 
-      image->set_color(position, color);
-      agateSlotCopy(vm, AGATE_RETURN_SLOT, 2);
-    }
+  AsyncLoad *AsyncLoad::start(const char *filename, bool texture_wanted, TextureFormat format) {
+    auto load = new AsyncLoad;
+    load->filename = filename;
+    load->texture_wanted = texture_wanted;
+    load->format = format;
 
-    static void subscript_setter2(AgateVM *vm) {
-      assert(agateCheckTag<ImageClass>(vm, 0));
-      auto image = agateSlotGet<ImageClass>(vm, 0);
+    load->acquire(); // for the worker
 
-      Vec2I position;
+    WorkerPool::get().submit([load]() {
+      Image image(load->filename.c_str());
+      const bool loaded = image.loaded();
 
-      if (!agateCheck(vm, 1, position.x)) {
-        agateError(vm, "Int parameter expected for `x`.");
-        return;
-      }
+      // the conversion is done here rather than on the render thread
+      std::vector<uint8_t> converted;
 
-      if (!agateCheck(vm, 2, position.y)) {
-        agateError(vm, "Int parameter expected for `y`.");
-        return;
+      if (loaded && load->texture_wanted && load->format != TextureFormat::RGBA8) {
+        converted.resize(static_cast<std::size_t>(image.width) * image.height * compute_pixel_size(load->format));
+        convert_rows(load->format, image.pixels, static_cast<std::size_t>(image.width) * 4, converted.data(), image.width, image.height);
       }
 
-      Color color;
+      {
+        std::lock_guard<std::mutex> lock(load->mutex);
 
-      if (!agateCheck(vm, 3, color)) {
-        agateError(vm, "Color parameter expected for `color`.");
-        return;
+        if (loaded) {
+          load->image = image;
+          load->converted = std::move(converted);
+          load->status = load->texture_wanted ? AsyncStatus::DECODED : AsyncStatus::READY;
+        } else {
+          load->status = AsyncStatus::FAILED;
+        }
       }
 
-      image->set_color(position, color);
-      agateSlotCopy(vm, AGATE_RETURN_SLOT, 3);
-    }
-
+      load->condition.notify_all();
 
-  };
+      if (loaded && load->texture_wanted) {
+        load->acquire(); // for the queue
+        std::lock_guard<std::mutex> lock(upload_mutex);
+        upload_queue.push_back(load);
+      }
 
-  /*
-   * Texture
-   */
+      load->release();
+      sdl_wake();
+    });
 
-  Texture::Texture(TextureKind kind, GLsizei width, GLsizei height, const uint8_t *data)
-  : kind(kind)
-  , id(0)
-  , width(width)
-  , height(height)
-  , flags(0)
-  , framebuffer(0)
-  {
-    GAMMA_GL_CHECK(glGenTextures(1, &id));
+    return load;
+  }
 
-    if (id == 0) {
+  void AsyncLoad::release() {
+    if (--references > 0) {
       return;
     }
 
-    GLint alignment = (kind == TextureKind::COLOR) ? 4 : 1;
-    GLenum format = (kind == TextureKind::COLOR) ? GL_RGBA : GL_RED;
-
-    GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, alignment));
-    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, id));
-    GAMMA_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data));
-    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
-    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
-    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
-    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
-    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
-  }
-
-  void Texture::destroy() {
-    if (framebuffer != 0) {
-      glDeleteFramebuffers(1, &framebuffer);
-      framebuffer = 0;
+    // the last reference of a texture load is never the worker, so this is the render thread
+    if (image.loaded()) {
+      image.destroy();
     }
 
-    if (id != 0) {
-      glDeleteTextures(1, &id);
-      id = 0;
+    if (texture.id != 0) {
+      texture.destroy();
     }
 
-    width = height = flags = 0;
+    delete this;
   }
 
-  GLenum Texture::compute_min_filter() const {
-    if (has_mipmap()) {
-      return is_smooth() ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR;
+  AsyncStatus AsyncLoad::wait() {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [this]() { return status != AsyncStatus::PENDING; });
     }
 
-    return is_smooth() ? GL_LINEAR : GL_NEAREST;
+    // do not wait for the next frames
+    stream(std::numeric_limits<std::size_t>::max());
+    return get_status();
   }
 
-  void Texture::make_renderable(Vec2I size) {
-    if (size.x != width || size.y != height) {
-      width = size.x;
-      height = size.y;
-
-      GLint alignment = (kind == TextureKind::COLOR) ? 4 : 1;
-      GLenum format = (kind == TextureKind::COLOR) ? GL_RGBA : GL_RED;
+  // upload the next rows of the texture within the budget (at least one row), return the uploaded size
+  std::size_t AsyncLoad::stream(std::size_t budget) {
+    std::lock_guard<std::mutex> lock(mutex);
 
-      GAMMA_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, alignment));
-      GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, id));
-      GAMMA_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, nullptr));
+    if (status != AsyncStatus::DECODED) {
+      return 0;
     }
 
-    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
-
-    if (framebuffer == 0) {
-      GAMMA_GL_CHECK(glGenFramebuffers(1, &framebuffer));
-      GAMMA_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, framebuffer));
-      GAMMA_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0));
-      assert(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
-    } else {
-      GAMMA_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, framebuffer));
+    if (texture.id == 0) {
+      texture = Texture(format, image.width, image.height, nullptr);
     }
-  }
 
-  struct TextureApi : TextureClass {
+    const uint8_t *data = converted.empty() ? image.pixels : converted.data();
+    const std::size_t stride = static_cast<std::size_t>(image.width) * compute_pixel_size(format);
+    const int remaining_rows = image.height - uploaded_rows;
+    const int rows = static_cast<int>(std::clamp(budget / stride, std::size_t(1), static_cast<std::size_t>(remaining_rows)));
 
-    static void destroy(AgateVM *vm, const char *unit_name, const char *class_name, void *data) {
-      auto texture = static_cast<Texture *>(data);
-      texture->destroy();
+    PixelUploader::get().upload(texture.id, format, { { 0, uploaded_rows }, { image.width, rows } }, data + uploaded_rows * stride, stride);
+    uploaded_rows += rows;
+
+    if (uploaded_rows == image.height) {
+      image.destroy();
+      converted = std::vector<uint8_t>();
+      TextureManager::get().set_source(texture.id, filename.c_str());
+      status = AsyncStatus::READY;
     }
 
-    static void new1(AgateVM *vm) {
-      assert(agateCheckTag<TextureClass>(vm, 0));
-      auto texture = agateSlotGet<TextureClass>(vm, 0);
+    return rows * stride;
+  }
 
-      Vec2I size;
+  bool has_pending_texture_uploads() {
+    std::lock_guard<std::mutex> lock(upload_mutex);
+    return !upload_queue.empty();
+  }
 
-      if (!agateCheck(vm, 1, size)) {
-        agateError(vm, "Vec2I parameter expected for `value`.");
-        return;
-      }
+  void process_texture_uploads(std::size_t budget) {
+    std::size_t uploaded = 0;
 
-      new (texture) Texture(TextureKind::COLOR, size.x, size.y, nullptr);
-    }
+    // large textures are split in row tiles over several frames
+    while (uploaded == 0 || uploaded < budget) {
+      AsyncLoad *load = nullptr;
 
-    static void from_file(AgateVM *vm) {
-      assert(agateCheckTag<TextureClass>(vm, 0));
-      auto texture = agateSlotGet<TextureClass>(vm, 0);
+      {
+        std::lock_guard<std::mutex> lock(upload_mutex);
 
-      const char *filename = nullptr;
+        if (upload_queue.empty()) {
+          break;
+        }
 
-      if (!agateCheck(vm, 1, filename)) {
-        agateError(vm, "String parameter expected for `filename`.");
-        return;
+        load = upload_queue.front();
       }
 
-      Image image(filename);
+      uploaded += load->stream(budget > uploaded ? budget - uploaded : 0);
 
-      if (!image.loaded()) {
-        agateError(vm, "Unable to load texture: '%s'.", filename);
-        return;
+      if (load->get_status() == AsyncStatus::DECODED) {
+        break; // continued in the next frame
       }
 
-      new (texture) Texture(TextureKind::COLOR, image.width, image.height, image.pixels);
-      image.destroy();
+      {
+        std::lock_guard<std::mutex> lock(upload_mutex);
+        upload_queue.pop_front();
+      }
+
+      load->release();
     }
+  }
 
-    static void from_image(AgateVM *vm) {
-      assert(agateCheckTag<TextureClass>(vm, 0));
-      auto texture = agateSlotGet<TextureClass>(vm, 0);
+  struct LoadFutureApi {
 
-      if (!agateCheckTag<ImageClass>(vm, 1)) {
-        agateError(vm, "Image parameter expected for `image`.");
-        return;
+    static void destroy(AgateVM *vm, const char *unit_name, const char *class_name, void *data) {
+      auto future = static_cast<LoadFuture *>(data);
+
+      if (future->handle != nullptr) {
+        agateReleaseHandle(vm, future->handle);
+        future->handle = nullptr;
       }
 
-      auto image = agateSlotGet<ImageClass>(vm, 1);
-      new (texture) Texture(TextureKind::COLOR, image->width, image->height, image->pixels);
+      if (future->load != nullptr) {
+        future->load->release();
+        future->load = nullptr;
+      }
     }
 
-    static void get_size(AgateVM *vm) {
-      assert(agateCheckTag<TextureClass>(vm, 0));
-      auto texture = agateSlotGet<TextureClass>(vm, 0);
-
-      auto result = agateSlotNew<Vec2IClass>(vm, AGATE_RETURN_SLOT);
-      result->x = texture->width;
-      result->y = texture->height;
-    }
+    template<typename Class>
+    static void new1(AgateVM *vm) {
+      assert(agateCheckTag<Class>(vm, 0));
+      auto future = agateSlotGet<Class>(vm, 0);
 
-    static void set_size(AgateVM *vm) {
-      assert(agateCheckTag<TextureClass>(vm, 0));
-      auto texture = agateSlotGet<TextureClass>(vm, 0);
+      future->load = nullptr;
+      future->handle = nullptr;
 
-      Vec2I size;
+      const char *filename = nullptr;
 
-      if (!agateCheck(vm, 1, size)) {
-        agateError(vm, "Vec2I parameter expected for `value`.");
+      if (!agateCheck(vm, 1, filename)) {
+        agateError(vm, "String parameter expected for `filename`.");
         return;
       }
 
-      texture->width = size.x;
-      texture->height = size.y;
-
-      assert(texture->kind == TextureKind::COLOR);
-      glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
-      glBindTexture(GL_TEXTURE_2D, texture->id);
-      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texture->width, texture->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-      glBindTexture(GL_TEXTURE_2D, 0);
+      future->load = AsyncLoad::start(filename, std::is_same_v<Class, TextureFutureClass>, TextureFormat::RGBA8);
     }
 
-    static void is_smooth(AgateVM *vm) {
-      assert(agateCheckTag<TextureClass>(vm, 0));
-      auto texture = agateSlotGet<TextureClass>(vm, 0);
-      agateSlotSetBool(vm, AGATE_RETURN_SLOT, texture->is_smooth());
-    }
+    static void new2(AgateVM *vm) {
+      assert(agateCheckTag<TextureFutureClass>(vm, 0));
+      auto future = agateSlotGet<TextureFutureClass>(vm, 0);
 
-    static void set_smooth(AgateVM *vm) {
-      assert(agateCheckTag<TextureClass>(vm, 0));
-      auto texture = agateSlotGet<TextureClass>(vm, 0);
+      future->load = nullptr;
+      future->handle = nullptr;
 
-      bool smooth;
+      const char *filename = nullptr;
 
-      if (!agateCheck(vm, 1, smooth)) {
-        agateError(vm, "Bool parameter expected for `value`.");
+      if (!agateCheck(vm, 1, filename)) {
+        agateError(vm, "String parameter expected for `filename`.");
         return;
       }
 
-      if (smooth == texture->is_smooth()) {
-        return;
-      }
+      TextureFormat format;
 
-      if (smooth) {
-        texture->flags |= TEXTURE_SMOOTH;
-      } else {
-        texture->flags &= ~TEXTURE_SMOOTH;
+      if (!check_texture_format(vm, 2, format)) {
+        agateError(vm, "TextureFormat parameter expected for `format`.");
+        return;
       }
 
-      glBindTexture(GL_TEXTURE_2D, texture->id);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, texture->compute_min_filter());
-      glBindTexture(GL_TEXTURE_2D, 0);
+      future->load = AsyncLoad::start(filename, true, format);
     }
 
-    static void is_repeated(AgateVM *vm) {
-      assert(agateCheckTag<TextureClass>(vm, 0));
-      auto texture = agateSlotGet<TextureClass>(vm, 0);
-      agateSlotSetBool(vm, AGATE_RETURN_SLOT, texture->is_repeated());
+    template<typename Class>
+    static void is_ready(AgateVM *vm) {
+      assert(agateCheckTag<Class>(vm, 0));
+      auto future = agateSlotGet<Class>(vm, 0);
+      agateSlotSetBool(vm, AGATE_RETURN_SLOT, future->load->get_status() == AsyncStatus::READY);
     }
 
-    static void set_repeated(AgateVM *vm) {
-      assert(agateCheckTag<TextureClass>(vm, 0));
-      auto texture = agateSlotGet<TextureClass>(vm, 0);
-
-      bool repeated;
+    template<typename Class>
+    static void has_failed(AgateVM *vm) {
+      assert(agateCheckTag<Class>(vm, 0));
+      auto future = agateSlotGet<Class>(vm, 0);
+      agateSlotSetBool(vm, AGATE_RETURN_SLOT, future->load->get_status() == AsyncStatus::FAILED);
+    }
 
-      if (!agateCheck(vm, 1, repeated)) {
-        agateError(vm, "Bool parameter expected for `value`.");
+    // put the loaded object in the return slot, created on the first call
+    template<typename Class>
+    static void get_result(AgateVM *vm, LoadFuture *future) {
+      if (future->handle != nullptr) {
+        agateSlotSetHandle(vm, AGATE_RETURN_SLOT, future->handle);
         return;
       }
 
-      if (repeated == texture->is_repeated()) {
-        return;
-      }
+      AsyncLoad *load = future->load;
 
-      if (repeated) {
-        texture->flags |= TEXTURE_REPEATED;
+      if constexpr (std::is_same_v<Class, TextureFutureClass>) {
+        auto texture = agateSlotNew<TextureClass>(vm, AGATE_RETURN_SLOT);
+        *texture = load->texture;
+        load->texture.id = 0; // owned by the agate object from now on
       } else {
-        texture->flags &= ~TEXTURE_REPEATED;
+        auto image = agateSlotNew<ImageClass>(vm, AGATE_RETURN_SLOT);
+        *image = load->image;
+        load->image = Image();
       }
 
-      glBindTexture(GL_TEXTURE_2D, texture->id);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, repeated ? GL_REPEAT : GL_CLAMP_TO_EDGE);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, repeated ? GL_REPEAT : GL_CLAMP_TO_EDGE);
-      glBindTexture(GL_TEXTURE_2D, 0);
+      future->handle = agateSlotGetHandle(vm, AGATE_RETURN_SLOT);
     }
 
-    static void generate_mipmap(AgateVM *vm) {
-      assert(agateCheckTag<TextureClass>(vm, 0));
-      auto texture = agateSlotGet<TextureClass>(vm, 0);
-
-      if (texture->has_mipmap()) {
-        return;
+    template<typename Class>
+    static void get_object(AgateVM *vm) {
+      assert(agateCheckTag<Class>(vm, 0));
+      auto future = agateSlotGet<Class>(vm, 0);
+
+      switch (future->load->get_status()) {
+        case AsyncStatus::READY:
+          get_result<Class>(vm, future);
+          break;
+        case AsyncStatus::FAILED:
+          agateError(vm, "Unable to load: '%s'.", future->load->filename.c_str());
+          break;
+        default:
+          agateError(vm, "The load is not finished yet.");
+          break;
       }
+    }
 
-      texture->flags |= TEXTURE_MIPMAP;
+    template<typename Class>
+    static void wait(AgateVM *vm) {
+      assert(agateCheckTag<Class>(vm, 0));
+      auto future = agateSlotGet<Class>(vm, 0);
 
-      glBindTexture(GL_TEXTURE_2D, texture->id);
-      glGenerateMipmap(GL_TEXTURE_2D);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, texture->compute_min_filter());
-      glBindTexture(GL_TEXTURE_2D, 0);
+      if (future->load->wait() == AsyncStatus::FAILED) {
+        agateError(vm, "Unable to load: '%s'.", future->load->filename.c_str());
+        return;
+      }
 
+      get_result<Class>(vm, future);
     }
 
   };
@@ -605,25 +2948,75 @@ namespace gma {
   void SpriteUnit::provide_support(Support & support) {
     support.add_class_handler(unit_name, ImageClass::class_name, generic_handler<ImageClass>(ImageApi::destroy));
     support.add_class_handler(unit_name, TextureClass::class_name, generic_handler<TextureClass>(TextureApi::destroy));
+    support.add_class_handler(unit_name, ImageFutureClass::class_name, generic_handler<ImageFutureClass>(LoadFutureApi::destroy));
+    support.add_class_handler(unit_name, TextureFutureClass::class_name, generic_handler<TextureFutureClass>(LoadFutureApi::destroy));
     support.add_class_handler(unit_name, SpriteClass::class_name, generic_handler<SpriteClass>(SpriteApi::destroy));
 
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new(_)", ImageApi::new1);
     support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init from_file(_)", ImageApi::from_file);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "size", ImageApi::get_size);
     support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "[_]", ImageApi::subscript_getter1);
     support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "[_,_]", ImageApi::subscript_getter2);
     support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "[_]=(_)", ImageApi::subscript_setter1);
     support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "[_,_]=(_)", ImageApi::subscript_setter2);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "fill(_)", ImageApi::fill1);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "fill(_,_)", ImageApi::fill2);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "copy(_,_)", ImageApi::copy<2>);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "copy(_,_,_)", ImageApi::copy<3>);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "blend(_,_)", ImageApi::blend<2>);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "blend(_,_,_)", ImageApi::blend<3>);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "apply_lut(_)", ImageApi::apply_lut);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "apply_color_matrix(_)", ImageApi::apply_color_matrix);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "adjust_hsv(_,_,_)", ImageApi::adjust_hsv);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "blur(_)", ImageApi::blur);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "premultiply()", ImageApi::premultiply);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "downsample()", ImageApi::downsample);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "read_rows(_,_)", ImageApi::read_rows);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "write_rows(_,_)", ImageApi::write_rows);
+    support.add_method(unit_name, ImageApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "save(_)", ImageApi::save);
 
     support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new(_)", TextureApi::new1);
-    support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init from_file(_)", TextureApi::from_file);
-    support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init from_image(_)", TextureApi::from_image);
+    support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new(_,_)", TextureApi::new2);
+    support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init from_file(_)", TextureApi::from_file1);
+    support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init from_file(_,_)", TextureApi::from_file2);
+    support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init from_image(_)", TextureApi::from_image1);
+    support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init from_image(_,_)", TextureApi::from_image2);
+    support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "update(_)", TextureApi::update1);
+    support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "update(_,_)", TextureApi::update2);
     support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "size", TextureApi::get_size);
     support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "size=(_)", TextureApi::set_size);
+    support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "format", TextureApi::get_format);
     support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "smooth", TextureApi::is_smooth);
     support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "smooth=(_)", TextureApi::set_smooth);
     support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "repeated", TextureApi::is_repeated);
     support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "repeated=(_)", TextureApi::set_repeated);
     support.add_method(unit_name, TextureApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "generate_mipmap()", TextureApi::generate_mipmap);
 
+    #define X(name, format) support.add_method(unit_name, TextureFormatApi::class_name, AGATE_FOREIGN_METHOD_CLASS, #name, TextureFormatApi::name);
+    GAMMA_TEXTURE_FORMAT_LIST
+    #undef X
+
+    support.add_method(unit_name, TextureManagerApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "budget", TextureManagerApi::get_budget);
+    support.add_method(unit_name, TextureManagerApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "budget=(_)", TextureManagerApi::set_budget);
+    support.add_method(unit_name, TextureManagerApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "resident_size", TextureManagerApi::get_resident_size);
+    support.add_method(unit_name, TextureManagerApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "hits", TextureManagerApi::get_hits);
+    support.add_method(unit_name, TextureManagerApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "misses", TextureManagerApi::get_misses);
+    support.add_method(unit_name, TextureManagerApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "evictions", TextureManagerApi::get_evictions);
+    support.add_method(unit_name, TextureManagerApi::class_name, AGATE_FOREIGN_METHOD_CLASS, "reset_stats()", TextureManagerApi::reset_stats);
+
+    support.add_method(unit_name, ImageFutureClass::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new(_)", LoadFutureApi::new1<ImageFutureClass>);
+    support.add_method(unit_name, ImageFutureClass::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "ready", LoadFutureApi::is_ready<ImageFutureClass>);
+    support.add_method(unit_name, ImageFutureClass::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "failed", LoadFutureApi::has_failed<ImageFutureClass>);
+    support.add_method(unit_name, ImageFutureClass::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "image", LoadFutureApi::get_object<ImageFutureClass>);
+    support.add_method(unit_name, ImageFutureClass::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "wait()", LoadFutureApi::wait<ImageFutureClass>);
+
+    support.add_method(unit_name, TextureFutureClass::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new(_)", LoadFutureApi::new1<TextureFutureClass>);
+    support.add_method(unit_name, TextureFutureClass::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new(_,_)", LoadFutureApi::new2);
+    support.add_method(unit_name, TextureFutureClass::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "ready", LoadFutureApi::is_ready<TextureFutureClass>);
+    support.add_method(unit_name, TextureFutureClass::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "failed", LoadFutureApi::has_failed<TextureFutureClass>);
+    support.add_method(unit_name, TextureFutureClass::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "texture", LoadFutureApi::get_object<TextureFutureClass>);
+    support.add_method(unit_name, TextureFutureClass::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "wait()", LoadFutureApi::wait<TextureFutureClass>);
+
     support.add_method(unit_name, SpriteApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new(_)", SpriteApi::new1);
     support.add_method(unit_name, SpriteApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "texture", SpriteApi::get_texture);
     support.add_method(unit_name, SpriteApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "texture=(_)", SpriteApi::set_texture);
@@ -1,7 +1,11 @@
 #ifndef GAMMA_SPRITE_H
 #define GAMMA_SPRITE_H
 
+#include <cstddef>
 #include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
 
 #include "glad/glad.h"
 
@@ -24,17 +28,62 @@ namespace gma {
     int width;
     int height;
     uint8_t *pixels;
+    RectI dirty; // modified region since the last texture update
 
     Image() = default;
     Image(const char *filename);
+    Image(Vec2I size);
     void destroy();
 
+    // read the size of an image file without decoding it
+    static bool read_size(const char *filename, int& width, int& height);
+
     bool loaded() const {
       return width != 0 && height != 0 && pixels != nullptr;
     }
 
+    // QOI if the extension is `.qoi`, PNG otherwise
+    bool save(const char *filename) const;
+    bool save_png(const char *filename) const;
+    bool save_qoi(const char *filename) const;
+
+    // rows are stored bottom up, `y` is top down like positions
+    uint8_t *get_row(int y) {
+      return pixels + static_cast<std::size_t>(height - y - 1) * width * 4;
+    }
+
+    const uint8_t *get_row(int y) const {
+      return pixels + static_cast<std::size_t>(height - y - 1) * width * 4;
+    }
+
+    void mark_dirty(RectI rect);
+
+    void mark_all_dirty() {
+      mark_dirty({ { 0, 0 }, { width, height } });
+    }
+
+    bool is_dirty() const {
+      return dirty.size.x > 0 && dirty.size.y > 0;
+    }
+
     Color get_color(Vec2I position) const;
     void set_color(Vec2I position, Color color);
+
+    // bulk operations, the rectangles are clipped to the images
+    void fill(RectI rect, Color color);
+    void copy(const Image& source, RectI source_rect, Vec2I position);
+    void blend(const Image& source, RectI source_rect, Vec2I position);
+    void apply_lut(const uint8_t lut[4][256]);
+
+    void read_rows(int y, int count, uint8_t *data) const;
+    void write_rows(int y, int count, const uint8_t *data);
+
+    // filters, split across threads by row bands
+    void apply_color_matrix(const float matrix[4][5]);
+    void adjust_hsv(float hue, float saturation, float value);
+    void blur(float sigma);
+    void premultiply();
+    Image downsample() const;
   };
 
   struct ImageClass : SpriteUnit {
@@ -56,8 +105,21 @@ namespace gma {
     ALPHA,
   };
 
+  // internal formats, images are converted from RGBA8 when the texture is created or updated
+  enum class TextureFormat {
+    RGBA8,
+    RGB8,
+    RGB565,
+    RGBA4444,
+    RG8,      // red and green channels, sampled as (r, g, 0, 1)
+    R8,       // alpha channel of the image, sampled as (1, 1, 1, a)
+  };
+
+  std::size_t compute_pixel_size(TextureFormat format);
+
   struct Texture {
     TextureKind kind;
+    TextureFormat format;
     GLuint id;
     GLsizei width;
     GLsizei height;
@@ -66,6 +128,9 @@ namespace gma {
 
     Texture() = default;
     Texture(TextureKind kind, GLsizei width, GLsizei height, const uint8_t *data);
+    // `data` is already in the layout of the format
+    Texture(TextureFormat format, GLsizei width, GLsizei height, const uint8_t *data);
+    Texture(TextureFormat format, const Image& image);
     void destroy();
 
     bool is_smooth() const {
@@ -81,7 +146,38 @@ namespace gma {
     }
 
     GLenum compute_min_filter() const;
+    void resize(Vec2I size);
     void make_renderable(Vec2I size);
+
+    // upload a region of an image of the same size, `rect` is top down like image positions
+    void update(const Image& image, RectI rect);
+  };
+
+  /*
+   * PixelUploader
+   */
+
+  // ring of pixel unpack buffers, data is copied in a mapped buffer and then uploaded from the buffer
+  struct PixelUploader {
+    static constexpr int BufferCount = 3;
+    static constexpr std::size_t BufferSize = 4 * 1024 * 1024;
+
+    GLuint buffers[BufferCount];
+    GLsync fences[BufferCount];
+    int current;
+
+    void create();
+    void destroy();
+
+    bool created() const {
+      return buffers[0] != 0;
+    }
+
+    // upload the rows of `data` in the region of the texture, `stride` is the size of a row of `data`
+    void upload(GLuint texture, TextureFormat format, RectI region, const uint8_t *data, std::size_t stride);
+
+    // shared uploader, created on first use and destroyed with the renderer
+    static PixelUploader& get();
   };
 
   struct TextureClass : SpriteUnit {
@@ -90,6 +186,111 @@ namespace gma {
     static constexpr uint64_t tag = compute_tag(unit_name, class_name);
   };
 
+  struct TextureFormatClass : SpriteUnit {
+    // no type
+    static constexpr const char * class_name = "TextureFormat";
+    static constexpr uint64_t tag = compute_tag(unit_name, class_name);
+  };
+
+  /*
+   * TextureManager
+   */
+
+  // residency of the textures in GPU memory, the textures loaded from a file are evicted to a transparent
+  // placeholder when the resident textures exceed the budget, and streamed in again on their next use
+  struct TextureManager {
+    struct Entry {
+      GLsizei width;
+      GLsizei height;
+      TextureFormat format;
+      bool mipmap;
+      bool renderable;
+      std::size_t size; // in GPU memory, including the mipmaps
+      std::string filename; // the source of the texture, empty if the texture can not be loaded again
+      bool resident;
+      bool loading;
+      bool deferred; // never loaded yet, the first load is synchronous
+      uint64_t generation; // to discard the loads of a previous texture with the same id
+      uint64_t last_use; // frame
+      std::list<GLuint>::iterator position; // in the LRU list
+    };
+
+    std::unordered_map<GLuint, Entry> entries;
+    std::list<GLuint> lru; // most recently used first
+    std::size_t budget = 0; // no budget if zero
+    std::size_t resident_size = 0;
+    uint64_t frame = 0;
+    uint64_t generations = 0;
+
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    void add(const Texture& texture);
+    void remove(GLuint id);
+    // after a change of the size, the format or the flags of the texture
+    void refresh(const Texture& texture);
+
+    void set_source(GLuint id, const char *filename);
+    // the texture is not loaded yet, it is loaded from its source on first use
+    void defer(GLuint id, const char *filename);
+    // the content of the texture does not come from its source anymore
+    void clear_source(GLuint id);
+
+    // called for each draw, a texture that is not resident is streamed in
+    void touch(GLuint id);
+    // load the texture synchronously if it has been evicted
+    void make_resident(GLuint id);
+
+    // once per frame on the render thread: upload the loaded textures and evict the least recently used ones
+    void update();
+
+    void reset_stats() {
+      hits = misses = evictions = 0;
+    }
+
+    static TextureManager& get();
+
+  private:
+    void release(GLuint id, Entry& entry);
+    void evict(GLuint id, Entry& entry);
+    void upload(GLuint id, Entry& entry, const uint8_t *data);
+  };
+
+  struct TextureManagerClass : SpriteUnit {
+    // no type
+    static constexpr const char * class_name = "TextureManager";
+    static constexpr uint64_t tag = compute_tag(unit_name, class_name);
+  };
+
+  /*
+   * Asynchronous loading
+   */
+
+  struct AsyncLoad;
+
+  // a pending image or texture, decoded by the worker pool
+  struct LoadFuture {
+    AsyncLoad *load;
+    AgateHandle *handle; // the loaded object, once it has been requested
+  };
+
+  struct ImageFutureClass : SpriteUnit {
+    using type = LoadFuture;
+    static constexpr const char * class_name = "ImageFuture";
+    static constexpr uint64_t tag = compute_tag(unit_name, class_name);
+  };
+
+  struct TextureFutureClass : SpriteUnit {
+    using type = LoadFuture;
+    static constexpr const char * class_name = "TextureFuture";
+    static constexpr uint64_t tag = compute_tag(unit_name, class_name);
+  };
+
+  // upload the decoded textures on the render thread, at least one texture and then up to `budget` bytes
+  void process_texture_uploads(std::size_t budget);
+  bool has_pending_texture_uploads();
+
   /*
    * Sprite
    */
@@ -1,9 +1,13 @@
 #include "gamma_support.h"
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <sstream>
 
+#include "gamma_file.h"
+#include "gamma_time.h"
+
 namespace gma {
 
   /*
@@ -15,6 +19,15 @@ namespace gma {
     m_include_paths.push_back(std::move(path));
   }
 
+  void Support::add_override_path(std::filesystem::path path) {
+    assert(std::filesystem::is_directory(path));
+    m_override_paths.push_back(std::move(path));
+  }
+
+  void Support::add_embedded_unit(const char *unit_name, const char *source) {
+    m_embedded_units.emplace(unit_name, source);
+  }
+
   const char *Support::load_unit(const char *name) {
     std::filesystem::path unit_name(name);
 
@@ -26,6 +39,10 @@ namespace gma {
   }
 
   const char *Support::try_load_unit_file(const std::filesystem::path& filename) {
+    if (auto maybe_content = try_load_unit_pack(filename)) {
+      return maybe_content;
+    }
+
     if (auto iterator = m_units.find(filename); iterator != m_units.end()) {
       return iterator->second.c_str();
     }
@@ -48,8 +65,25 @@ namespace gma {
     std::filesystem::path unit_filename(unit_name);
     unit_filename.replace_extension("agate");
 
-    for (auto & include_path : m_include_paths) {
-      std::filesystem::path filename = include_path / unit_filename;
+    if (auto maybe_content = try_load_unit_in(m_override_paths, unit_filename)) {
+      return maybe_content;
+    }
+
+    if (auto maybe_content = try_load_unit_pack(unit_filename)) {
+      return maybe_content;
+    }
+
+    // the standard units are compiled in, the file system is not probed for them
+    if (auto iterator = m_embedded_units.find(unit_name.generic_string()); iterator != m_embedded_units.end()) {
+      return iterator->second;
+    }
+
+    return try_load_unit_in(m_include_paths, unit_filename);
+  }
+
+  const char *Support::try_load_unit_in(const std::vector<std::filesystem::path>& paths, const std::filesystem::path& unit_filename) {
+    for (auto & path : paths) {
+      std::filesystem::path filename = path / unit_filename;
 
       auto maybe_content = try_load_unit_file(filename);
 
@@ -61,24 +95,71 @@ namespace gma {
     return nullptr;
   }
 
+  const char *Support::try_load_unit_pack(const std::filesystem::path& filename) {
+    // the files of a pack are followed by a null character, the unit is used in place
+    if (PackFile packed; find_in_packs(filename.generic_string(), packed)) {
+      return reinterpret_cast<const char *>(packed.data);
+    }
+
+    return nullptr;
+  }
+
   const char *Support::unit_load(const char *name, void *user_data) {
     Support *support = static_cast<Support *>(user_data);
+    StartupPhase phase(std::string("import ") + name);
     return support->try_load_unit(name);
   }
 
+  /*
+   * tag tables
+   */
+
+  template<typename T>
+  void Support::sort_table(std::vector<std::pair<uint64_t, T>>& table) {
+    std::stable_sort(table.begin(), table.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.first < rhs.first;
+    });
+
+    // the last registration wins, like an assignment in a map
+    auto last = std::unique(table.rbegin(), table.rend(), [](const auto& lhs, const auto& rhs) {
+      return lhs.first == rhs.first;
+    });
+
+    table.erase(table.begin(), last.base());
+  }
+
+  template<typename T>
+  const T *Support::find_in_table(const std::vector<std::pair<uint64_t, T>>& table, uint64_t tag) {
+    auto iterator = std::lower_bound(table.begin(), table.end(), tag, [](const auto& entry, uint64_t value) {
+      return entry.first < value;
+    });
+
+    if (iterator == table.end() || iterator->first != tag) {
+      return nullptr;
+    }
+
+    return &iterator->second;
+  }
+
   /*
    * foreign class handling
    */
 
-  void Support::add_class_handler(const char *unit_name, const char *class_name, AgateForeignClassHandler handler) {
-    m_class_handlers[std::make_tuple(unit_name, class_name)] = handler;
+  void Support::add_tagged_class_handler(uint64_t tag, AgateForeignClassHandler handler) {
+    m_class_handlers.emplace_back(tag, handler);
+    m_class_handlers_sorted = false;
   }
 
   AgateForeignClassHandler Support::get_class_handler(const char *unit_name, const char *class_name) {
     AgateForeignClassHandler null_handler = { nullptr, nullptr, nullptr };
 
-    if (auto iterator = m_class_handlers.find(std::make_tuple(unit_name, class_name)); iterator != m_class_handlers.end()) {
-      return iterator->second;
+    if (!m_class_handlers_sorted) {
+      sort_table(m_class_handlers);
+      m_class_handlers_sorted = true;
+    }
+
+    if (auto handler = find_in_table(m_class_handlers, compute_tag(unit_name, class_name)); handler != nullptr) {
+      return *handler;
     }
 
     return null_handler;
@@ -88,13 +169,19 @@ namespace gma {
    * foreign method handling
    */
 
-  void Support::add_method(const char *unit_name, const char *class_name, AgateForeignMethodKind kind, const char *signature, AgateForeignMethodFunc func) {
-    m_methods[std::make_tuple(unit_name, class_name, kind, signature)] = func;
+  void Support::add_tagged_method(uint64_t tag, AgateForeignMethodFunc func) {
+    m_methods.emplace_back(tag, func);
+    m_methods_sorted = false;
   }
 
   AgateForeignMethodFunc Support::get_method(const char *unit_name, const char *class_name, AgateForeignMethodKind kind, const char *signature) {
-    if (auto iterator = m_methods.find(std::make_tuple(unit_name, class_name, kind, signature)); iterator != m_methods.end()) {
-      return iterator->second;
+    if (!m_methods_sorted) {
+      sort_table(m_methods);
+      m_methods_sorted = true;
+    }
+
+    if (auto func = find_in_table(m_methods, compute_method_tag(unit_name, class_name, kind, signature)); func != nullptr) {
+      return *func;
     }
 
     return nullptr;
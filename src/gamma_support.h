@@ -4,8 +4,8 @@
 #include <filesystem>
 #include <map>
 #include <optional>
-#include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "agate.h"
@@ -17,11 +17,21 @@ namespace gma {
   class Support {
   public:
     void add_include_path(std::filesystem::path path);
+    // searched before the embedded units, for development
+    void add_override_path(std::filesystem::path path);
+    // `source` must outlive the support
+    void add_embedded_unit(const char *unit_name, const char *source);
     const char *load_unit(const char *unit_name);
 
-    void add_class_handler(const char *unit_name, const char *class_name, AgateForeignClassHandler handler);
+    // the names are hashed with the tag functions, inlined so that literal names are hashed at compile time
 
-    void add_method(const char *unit_name, const char *class_name, AgateForeignMethodKind kind, const char *signature, AgateForeignMethodFunc func);
+    void add_class_handler(const char *unit_name, const char *class_name, AgateForeignClassHandler handler) {
+      add_tagged_class_handler(compute_tag(unit_name, class_name), handler);
+    }
+
+    void add_method(const char *unit_name, const char *class_name, AgateForeignMethodKind kind, const char *signature, AgateForeignMethodFunc func) {
+      add_tagged_method(compute_method_tag(unit_name, class_name, kind, signature), func);
+    }
 
     static AgateUnitHandler unit_handler(AgateVM *vm, const char *name);
     static AgateForeignClassHandler foreign_class_handler(AgateVM *vm, const char *unit_name, const char *class_name);
@@ -30,17 +40,33 @@ namespace gma {
   private:
     const char *try_load_unit_file(const std::filesystem::path& filename);
     const char *try_load_unit(const std::filesystem::path& unit_name);
+    const char *try_load_unit_pack(const std::filesystem::path& filename);
+    const char *try_load_unit_in(const std::vector<std::filesystem::path>& paths, const std::filesystem::path& unit_filename);
     static const char *unit_load(const char *name, void *user_data);
 
+    void add_tagged_class_handler(uint64_t tag, AgateForeignClassHandler handler);
+    void add_tagged_method(uint64_t tag, AgateForeignMethodFunc func);
+
     AgateForeignClassHandler get_class_handler(const char *unit_name, const char *class_name);
     AgateForeignMethodFunc get_method(const char *unit_name, const char *class_name, AgateForeignMethodKind kind, const char *signature);
 
+    template<typename T>
+    static void sort_table(std::vector<std::pair<uint64_t, T>>& table);
+
+    template<typename T>
+    static const T *find_in_table(const std::vector<std::pair<uint64_t, T>>& table, uint64_t tag);
+
 
   private:
     std::vector<std::filesystem::path> m_include_paths;
+    std::vector<std::filesystem::path> m_override_paths;
+    std::map<std::string, const char *> m_embedded_units;
     std::map<std::filesystem::path, std::string> m_units;
-    std::map<std::tuple<std::string, std::string>, AgateForeignClassHandler> m_class_handlers;
-    std::map<std::tuple<std::string, std::string, AgateForeignMethodKind, std::string>, AgateForeignMethodFunc> m_methods;
+    // flat tables sorted by tag on the first lookup, filled before the VM runs
+    std::vector<std::pair<uint64_t, AgateForeignClassHandler>> m_class_handlers;
+    std::vector<std::pair<uint64_t, AgateForeignMethodFunc>> m_methods;
+    bool m_class_handlers_sorted = false;
+    bool m_methods_sorted = false;
   };
 
   template<typename Class>
@@ -40,6 +40,21 @@ namespace gma {
     return tag.result();
   }
 
+  constexpr uint64_t compute_method_tag(const char *unit_name, const char *class_name, AgateForeignMethodKind kind, const char *signature) {
+    constexpr char separator = ':';
+    const char kind_marker = (kind == AGATE_FOREIGN_METHOD_INSTANCE) ? 'i' : 'c';
+
+    Tag tag;
+    tag.hash(unit_name, std::char_traits<char>::length(unit_name));
+    tag.hash(&separator, 1);
+    tag.hash(class_name, std::char_traits<char>::length(class_name));
+    tag.hash(&separator, 1);
+    tag.hash(&kind_marker, 1);
+    tag.hash(&separator, 1);
+    tag.hash(signature, std::char_traits<char>::length(signature));
+    return tag.result();
+  }
+
   template<typename Class>
   inline
   uint64_t generic_tag(AgateVM *vm, const char *unit_name, const char *class_name) {
@@ -1,10 +1,17 @@
 #include "gamma_text.h"
 
 #include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <string_view>
 
 #include "gamma_agate.h"
 #include "gamma_debug.h"
 #include "gamma_render.h"
+#include "gamma_simd.h"
+#include "gamma_sprite.h"
 
 namespace gma {
 
@@ -21,28 +28,96 @@ namespace gma {
   FT_Library Font::library = nullptr;
 
   void Font::destroy() {
-    delete cache;
-    cache = nullptr;
-
     if (face != nullptr) {
-      if (FT_Error err; (err = FT_Done_Face(face)) != 0) {
-      }
-
+      FontFace::release(face);
       face = nullptr;
     }
 
-    if (stroker != nullptr) {
-      FT_Stroker_Done(stroker);
-      stroker = nullptr;
+    if (bitmap != nullptr) {
+      bitmap->destroy();
+      delete bitmap;
+      bitmap = nullptr;
+    }
+  }
+
+  /*
+   * FontFace
+   */
+
+  // all the faces currently loaded, indexed by absolute filename
+  static std::map<std::string, FontFace *> loaded_faces;
+
+  FontFace *FontFace::acquire(const char *filename) {
+    std::string key = std::filesystem::absolute(filename).lexically_normal().string();
+
+    if (auto iterator = loaded_faces.find(key); iterator != loaded_faces.end()) {
+      FontFace *face = iterator->second;
+      ++face->references;
+      return face;
+    }
+
+    assert(Font::library != nullptr);
+
+    auto face = new FontFace;
+    face->filename = key;
+    face->file = FileMapping(filename);
+
+    if (!face->file.loaded()) {
+      delete face;
+      return nullptr;
+    }
+
+    if (FT_Error err; (err = FT_Stroker_New(Font::library, &face->stroker)) != 0) {
+      face->file.destroy();
+      delete face;
+      return nullptr;
+    }
+
+    // the file stays mapped as long as the face is alive
+    if (FT_Error err; (err = FT_New_Memory_Face(Font::library, face->file.data, static_cast<FT_Long>(face->file.size), 0, &face->face)) != 0) {
+      FT_Stroker_Done(face->stroker);
+      face->file.destroy();
+      delete face;
+      return nullptr;
+    }
+
+    face->references = 1;
+    loaded_faces.emplace(key, face);
+    return face;
+  }
+
+  void FontFace::release(FontFace *face) {
+    assert(face->references > 0);
+
+    if (--face->references > 0) {
+      return;
+    }
+
+    loaded_faces.erase(face->filename);
+
+    for (auto & glyph_cache : face->cache.cache_by_size) {
+      GAMMA_GL_CHECK(glDeleteTextures(1, &glyph_cache.texture));
+    }
+
+    if (face->face != nullptr) {
+      if (FT_Error err; (err = FT_Done_Face(face->face)) != 0) {
+      }
+    }
+
+    if (face->stroker != nullptr) {
+      FT_Stroker_Done(face->stroker);
     }
+
+    face->file.destroy();
+    delete face;
   }
 
-  GLuint Font::get_texture(FT_UInt size) {
+  GLuint FontFace::get_texture(FT_UInt size) {
     GlyphCache& cache = get_glyph_cache(size);
     return cache.texture;
   }
 
-  Glyph Font::compute_glyph(uint32_t codepoint, FT_UInt size, float outline_thickness) {
+  Glyph FontFace::compute_glyph(uint32_t codepoint, FT_UInt size, float outline_thickness) {
     GlyphCache& cache = get_glyph_cache(size);
 
     auto key = std::make_tuple(codepoint, outline_thickness);
@@ -55,7 +130,7 @@ namespace gma {
     return it->second;
   }
 
-  float Font::compute_kerning(uint32_t left, uint32_t right, FT_UInt size) {
+  float FontFace::compute_kerning(uint32_t left, uint32_t right, FT_UInt size) {
     if (left == 0 || right == 0) {
       return 0.0f;
     }
@@ -78,8 +153,8 @@ namespace gma {
     return convert(kerning.x);
   }
 
-  GlyphCache& Font::get_glyph_cache(FT_UInt size) {
-    auto & cache_by_size = cache->cache_by_size;
+  GlyphCache& FontFace::get_glyph_cache(FT_UInt size) {
+    auto & cache_by_size = cache.cache_by_size;
 
     auto it = std::find_if(cache_by_size.begin(), cache_by_size.end(), [size](const GlyphCache& glyph_cache) {
       return glyph_cache.size == size;
@@ -96,7 +171,7 @@ namespace gma {
   static constexpr int TextureSize = 4096;
   static constexpr int Padding = 1;
 
-  GlyphCache Font::create_cache(FT_UInt size) {
+  GlyphCache FontFace::create_cache(FT_UInt size) {
     GlyphCache cache;
     cache.size = size;
 
@@ -115,7 +190,7 @@ namespace gma {
     return cache;
   }
 
-  Glyph Font::create_glyph(uint32_t codepoint, FT_UInt size, float outline_thickness, GlyphCache& cache) {
+  Glyph FontFace::create_glyph(uint32_t codepoint, FT_UInt size, float outline_thickness, GlyphCache& cache) {
     Glyph result;
 
     set_character_size(size);
@@ -219,7 +294,7 @@ namespace gma {
     return result;
   }
 
-  void Font::set_character_size(FT_UInt size) {
+  void FontFace::set_character_size(FT_UInt size) {
     if (current_size == size) {
       return;
     }
@@ -232,7 +307,7 @@ namespace gma {
     current_size = size;
   }
 
-  float Font::compute_line_spacing(FT_UInt size) {
+  float FontFace::compute_line_spacing(FT_UInt size) {
     set_character_size(size);
     return convert(face->size->metrics.height);
   }
@@ -271,111 +346,442 @@ namespace gma {
         return;
       }
 
-      font->stroker = nullptr;
-      font->face = nullptr;
-      font->current_size = 0;
-      font->cache = nullptr;
-
-      assert(Font::library != nullptr);
-
-      if (FT_Error err; (err = FT_Stroker_New(Font::library, &font->stroker)) != 0) {
-        agateError(vm, "Could not create stroker.");
-        return;
-      }
+      font->kind = FontKind::OUTLINE;
+      font->bitmap = nullptr;
+      font->face = FontFace::acquire(filename);
 
-      if (FT_Error err; (err = FT_New_Face(Font::library, filename, 0, &font->face)) != 0) {
-        agateError(vm, "Could not create face.");
+      if (font->face == nullptr) {
+        agateError(vm, "Unable to load font: '%s'.", filename);
         return;
       }
-
-      font->cache = new FontCache;
     }
 
   };
 
   /*
-   * Text
+   * BitmapFace
    */
 
-  struct CodepointRange {
-    std::string_view ref;
-
-    struct Iterator {
-      using difference_type = std::ptrdiff_t;
-      using value_type = uint32_t;
-      using pointer = value_type;
-      using reference = value_type;
-      using iterator_category = std::forward_iterator_tag;
-
-      void swap(Iterator& other) noexcept { std::swap(current, other.current); }
-      constexpr reference operator*() const noexcept { return decode(); }
-      constexpr pointer operator->() const noexcept { return decode(); }
-      constexpr Iterator& operator++() noexcept { step(); return *this; }
-      constexpr Iterator operator++(int) noexcept {
-        Iterator copy = *this;
-        step();
-        return copy;
+  namespace {
+
+    // a line of a BMFont descriptor: a tag followed by key=value attributes
+    struct BitmapFontLine {
+      std::string_view tag;
+      std::vector<std::tuple<std::string_view, std::string_view>> attributes;
+
+      std::string_view get(std::string_view key) const {
+        for (auto [ attribute_key, attribute_value ] : attributes) {
+          if (attribute_key == key) {
+            return attribute_value;
+          }
+        }
+
+        return {};
+      }
+
+      int get_int(std::string_view key) const {
+        std::string_view raw = get(key);
+        int value = 0;
+        std::from_chars(raw.data(), raw.data() + raw.size(), value);
+        return value;
+      }
+    };
+
+    bool is_line_space(char c) {
+      return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    BitmapFontLine parse_bitmap_font_line(std::string_view line) {
+      BitmapFontLine result;
+      std::size_t sz = line.size();
+      std::size_t i = 0;
+
+      auto skip_spaces = [&]() {
+        while (i < sz && is_line_space(line[i])) {
+          ++i;
+        }
+      };
+
+      skip_spaces();
+      std::size_t start = i;
+
+      while (i < sz && !is_line_space(line[i])) {
+        ++i;
       }
-      constexpr bool operator!=(const Iterator& other) const noexcept { return current != other.current; }
-      constexpr bool operator==(const Iterator& other) const noexcept { return current == other.current; }
-
-      const char *current;
-
-    private:
-      constexpr uint32_t decode() const noexcept {
-        uint32_t codepoint = 0;
-        uint8_t c = current[0];
-
-        if ((c & 0b10000000) == 0b00000000) {
-          codepoint = c & 0b01111111;
-        } else if ((c & 0b11100000) == 0b11000000) {
-          codepoint = c & 0b00011111;
-          codepoint = (codepoint << 6) + (current[1] & 0b00111111);
-        } else if ((c & 0b11110000) == 0b11100000) {
-          codepoint = c & 0b00001111;
-          codepoint = (codepoint << 6) + (current[1] & 0b00111111);
-          codepoint = (codepoint << 6) + (current[2] & 0b00111111);
-        } else {
-          assert((c & 0b11111000) == 0b11110000);
-          codepoint = c & 0b00000111;
-          codepoint = (codepoint << 6) + (current[1] & 0b00111111);
-          codepoint = (codepoint << 6) + (current[2] & 0b00111111);
-          codepoint = (codepoint << 6) + (current[3] & 0b00111111);
+
+      result.tag = line.substr(start, i - start);
+
+      for (;;) {
+        skip_spaces();
+
+        if (i == sz) {
+          break;
+        }
+
+        start = i;
+
+        while (i < sz && line[i] != '=' && !is_line_space(line[i])) {
+          ++i;
+        }
+
+        std::string_view key = line.substr(start, i - start);
+        std::string_view value;
+
+        if (i < sz && line[i] == '=') {
+          ++i;
+
+          if (i < sz && line[i] == '"') {
+            start = ++i;
+
+            while (i < sz && line[i] != '"') {
+              ++i;
+            }
+
+            value = line.substr(start, i - start);
+
+            if (i < sz) {
+              ++i; // closing quote
+            }
+          } else {
+            start = i;
+
+            while (i < sz && !is_line_space(line[i])) {
+              ++i;
+            }
+
+            value = line.substr(start, i - start);
+          }
         }
 
-        return codepoint;
+        result.attributes.emplace_back(key, value);
       }
 
-      constexpr void step() noexcept {
-        uint8_t c = current[0];
-
-        if ((c & 0b10000000) == 0b00000000) {
-          current += 1;
-        } else if ((c & 0b11100000) == 0b11000000) {
-          current += 2;
-        } else if ((c & 0b11110000) == 0b11100000) {
-          current += 3;
-        } else {
-          assert((c & 0b11111000) == 0b11110000);
-          current += 4;
+      return result;
+    }
+
+  }
+
+  BitmapFace *BitmapFace::load(const char *filename) {
+    FileMapping file(filename);
+
+    if (!file.loaded()) {
+      return nullptr;
+    }
+
+    std::string_view content(reinterpret_cast<const char *>(file.data), file.size);
+    std::filesystem::path directory = std::filesystem::path(filename).parent_path();
+
+    int page_width = 0;
+    int page_height = 0;
+    bool alpha_in_red = false;
+    std::vector<std::string> pages;
+
+    // texture rectangles are in pixels and page-relative until all the pages are known
+    std::map<uint32_t, std::tuple<Glyph, int>> raw_glyphs;
+
+    auto face = new BitmapFace;
+
+    while (!content.empty()) {
+      std::size_t end = content.find('\n');
+      std::string_view raw_line = content.substr(0, end);
+      content.remove_prefix(end == std::string_view::npos ? content.size() : end + 1);
+
+      BitmapFontLine line = parse_bitmap_font_line(raw_line);
+
+      if (line.tag == "info") {
+        // a negative size means the size matches the character height
+        face->size = static_cast<float>(std::abs(line.get_int("size")));
+      } else if (line.tag == "common") {
+        face->line_height = static_cast<float>(line.get_int("lineHeight"));
+        face->base = static_cast<float>(line.get_int("base"));
+        page_width = line.get_int("scaleW");
+        page_height = line.get_int("scaleH");
+        pages.resize(line.get_int("pages"));
+        // 0 means the glyph is in the channel, 4 means the channel is set to one
+        alpha_in_red = line.get_int("alphaChnl") != 0 && line.get_int("redChnl") == 0;
+      } else if (line.tag == "page") {
+        auto id = static_cast<std::size_t>(line.get_int("id"));
+
+        if (id >= pages.size()) {
+          pages.resize(id + 1);
         }
+
+        pages[id] = (directory / std::string(line.get("file"))).generic_string();
+      } else if (line.tag == "char") {
+        Glyph glyph;
+        glyph.bounds.position = vec<float>(line.get_int("xoffset"), line.get_int("yoffset"));
+        glyph.bounds.size = vec<float>(line.get_int("width"), line.get_int("height"));
+        glyph.texture_rect.position = vec<float>(line.get_int("x"), line.get_int("y"));
+        glyph.texture_rect.size = glyph.bounds.size;
+        glyph.advance = static_cast<float>(line.get_int("xadvance"));
+        raw_glyphs[static_cast<uint32_t>(line.get_int("id"))] = std::make_tuple(glyph, line.get_int("page"));
+      } else if (line.tag == "kerning") {
+        auto key = std::make_tuple(static_cast<uint32_t>(line.get_int("first")), static_cast<uint32_t>(line.get_int("second")));
+        face->kernings[key] = static_cast<float>(line.get_int("amount"));
       }
-    };
+    }
+
+    file.destroy();
 
-    Iterator begin() const noexcept {
-      return Iterator{ ref.data() };
+    if (face->size <= 0.0f || page_width <= 0 || page_height <= 0 || pages.empty()) {
+      delete face;
+      return nullptr;
     }
 
-    Iterator end() const noexcept {
-      return Iterator{ ref.data() + ref.size() };
+    // stack the pages vertically
+
+    const int page_count = static_cast<int>(pages.size());
+    const std::size_t page_stride = static_cast<std::size_t>(page_width) * static_cast<std::size_t>(page_height) * 4;
+    std::vector<uint8_t> pixels(page_stride * page_count, 0);
+
+    for (int i = 0; i < page_count; ++i) {
+      Image page(pages[i].c_str());
+
+      if (!page.loaded()) {
+        delete face;
+        return nullptr;
+      }
+
+      if (page.width != page_width || page.height != page_height) {
+        page.destroy();
+        delete face;
+        return nullptr;
+      }
+
+      // the rows of the page are stored top down
+      const std::size_t row_size = static_cast<std::size_t>(page_width) * 4;
+
+      for (int y = 0; y < page_height; ++y) {
+        std::copy_n(page.get_row(y), row_size, pixels.data() + i * page_stride + y * row_size);
+      }
+
+      page.destroy();
     }
+
+    const Vec2F texture_size = vec<float>(page_width, page_height * page_count);
+
+    for (auto & [ codepoint, raw_glyph ] : raw_glyphs) {
+      auto [ glyph, page ] = raw_glyph;
+
+      // bounds are relative to the baseline, like outline fonts
+      glyph.bounds.position.y -= face->base;
+      glyph.texture_rect.position.y += static_cast<float>(page * page_height);
+      glyph.texture_rect.position /= texture_size;
+      glyph.texture_rect.size /= texture_size;
+
+      face->glyphs.emplace(codepoint, glyph);
+    }
+
+    GAMMA_GL_CHECK(glGenTextures(1, &face->texture));
+
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, face->texture));
+    GAMMA_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, page_width, page_height * page_count, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+
+    // pre-baked fonts are pixel exact, do not blur them
+    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+    GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+
+    if (alpha_in_red) {
+      GAMMA_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED));
+    }
+
+    GAMMA_GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+
+    return face;
+  }
+
+  void BitmapFace::destroy() {
+    if (texture != 0) {
+      GAMMA_GL_CHECK(glDeleteTextures(1, &texture));
+      texture = 0;
+    }
+  }
+
+  Glyph BitmapFace::compute_glyph(uint32_t codepoint, FT_UInt size) {
+    auto it = glyphs.find(codepoint);
+
+    if (it == glyphs.end()) {
+      return Glyph();
+    }
+
+    Glyph glyph = it->second;
+    float scale = compute_scale(size);
+    glyph.bounds.position *= scale;
+    glyph.bounds.size *= scale;
+    glyph.advance *= scale;
+    return glyph;
+  }
+
+  float BitmapFace::compute_kerning(uint32_t left, uint32_t right, FT_UInt size) {
+    if (left == 0 || right == 0) {
+      return 0.0f;
+    }
+
+    auto it = kernings.find(std::make_tuple(left, right));
+
+    if (it == kernings.end()) {
+      return 0.0f;
+    }
+
+    return it->second * compute_scale(size);
+  }
+
+  float BitmapFace::compute_line_spacing(FT_UInt size) {
+    return line_height * compute_scale(size);
+  }
+
+  struct BitmapFontApi : BitmapFontClass {
+
+    static void destroy(AgateVM *vm, const char *unit_name, const char *class_name, void *data) {
+      auto font = static_cast<Font *>(data);
+      font->destroy();
+    }
+
+    static void from_file(AgateVM *vm) {
+      assert(agateCheckTag<BitmapFontClass>(vm, 0));
+      auto font = agateSlotGet<BitmapFontClass>(vm, 0);
+
+      const char *filename = nullptr;
+
+      if (!agateCheck(vm, 1, filename)) {
+        agateError(vm, "String parameter expected for `filename`.");
+        return;
+      }
+
+      font->kind = FontKind::BITMAP;
+      font->face = nullptr;
+      font->bitmap = BitmapFace::load(filename);
+
+      if (font->bitmap == nullptr) {
+        agateError(vm, "Unable to load bitmap font: '%s'.", filename);
+        return;
+      }
+    }
+
+    static void get_size(AgateVM *vm) {
+      assert(agateCheckTag<BitmapFontClass>(vm, 0));
+      auto font = agateSlotGet<BitmapFontClass>(vm, 0);
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, static_cast<int64_t>(font->bitmap->size));
+    }
+
   };
 
-  constexpr CodepointRange codepoints(std::string_view ref) {
-    return CodepointRange{ ref };
+  /*
+   * UTF-8 decoding
+   */
+
+  static constexpr char32_t ReplacementCharacter = 0xFFFD;
+
+  // decode a multibyte sequence starting at `data`, invalid sequences give the replacement character
+  static std::size_t decode_utf8_sequence(const uint8_t *data, std::size_t size, char32_t& codepoint) {
+    assert(size > 0);
+    const uint8_t c = data[0];
+
+    std::size_t length = 0;
+    char32_t min = 0;
+
+    if ((c & 0b11100000) == 0b11000000) {
+      length = 2;
+      min = 0x80;
+      codepoint = c & 0b00011111;
+    } else if ((c & 0b11110000) == 0b11100000) {
+      length = 3;
+      min = 0x800;
+      codepoint = c & 0b00001111;
+    } else if ((c & 0b11111000) == 0b11110000) {
+      length = 4;
+      min = 0x10000;
+      codepoint = c & 0b00000111;
+    } else {
+      // unexpected continuation byte or invalid leading byte
+      codepoint = ReplacementCharacter;
+      return 1;
+    }
+
+    for (std::size_t i = 1; i < length; ++i) {
+      if (i >= size || (data[i] & 0b11000000) != 0b10000000) {
+        // truncated sequence, skip the valid prefix
+        codepoint = ReplacementCharacter;
+        return i;
+      }
+
+      codepoint = (codepoint << 6) + (data[i] & 0b00111111);
+    }
+
+    if (codepoint < min || codepoint > 0x10FFFF || (0xD800 <= codepoint && codepoint <= 0xDFFF)) {
+      // overlong encoding, out of range or surrogate
+      codepoint = ReplacementCharacter;
+    }
+
+    return length;
   }
 
-  bool is_delimiter(char c, std::string_view delimiters) {
+  std::u32string decode_utf8(std::string_view str) {
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(str.data());
+    const std::size_t size = str.size();
+
+    // there are never more codepoints than bytes
+    std::u32string result(size, U'\0');
+    char32_t *out = result.data();
+
+    std::size_t i = 0;
+
+    while (i < size) {
+#if defined(GAMMA_HAS_AVX2)
+      if (i + 32 <= size) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+
+        if (_mm256_movemask_epi8(chunk) == 0) {
+          // only ASCII, widen the 32 bytes
+          for (int k = 0; k < 4; ++k) {
+            __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(data + i + k * 8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + k * 8), _mm256_cvtepu8_epi32(bytes));
+          }
+
+          i += 32;
+          out += 32;
+          continue;
+        }
+      }
+#elif defined(GAMMA_HAS_SSE2)
+      if (i + 16 <= size) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+
+        if (_mm_movemask_epi8(chunk) == 0) {
+          // only ASCII, widen the 16 bytes
+          const __m128i zero = _mm_setzero_si128();
+          __m128i lo = _mm_unpacklo_epi8(chunk, zero);
+          __m128i hi = _mm_unpackhi_epi8(chunk, zero);
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(out +  0), _mm_unpacklo_epi16(lo, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(out +  4), _mm_unpackhi_epi16(lo, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(out +  8), _mm_unpacklo_epi16(hi, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 12), _mm_unpackhi_epi16(hi, zero));
+
+          i += 16;
+          out += 16;
+          continue;
+        }
+      }
+#endif
+
+      if (data[i] < 0x80) {
+        *out++ = data[i++];
+      } else {
+        i += decode_utf8_sequence(data + i, size - i, *out++);
+      }
+    }
+
+    result.resize(out - result.data());
+    return result;
+  }
+
+  /*
+   * Text
+   */
+
+  bool is_delimiter(char32_t c, std::u32string_view delimiters) {
     for (auto d : delimiters) {
       if (c == d) {
         return true;
@@ -386,10 +792,10 @@ namespace gma {
   }
 
 
-  std::vector<std::string_view> split(std::string_view str, std::string_view delimiters) {
+  std::vector<std::u32string_view> split(std::u32string_view str, std::u32string_view delimiters) {
     std::size_t sz = str.size();
     std::size_t i = 0;
-    std::vector<std::string_view> result;
+    std::vector<std::u32string_view> result;
 
     while (i < sz) {
       while (i < sz && is_delimiter(str[i], delimiters)) {
@@ -400,7 +806,7 @@ namespace gma {
         break;
       }
 
-      const char *start = str.data() + i;
+      const char32_t *start = str.data() + i;
       size_t len = 0;
 
       while (i < sz && !is_delimiter(str[i], delimiters)) {
@@ -408,22 +814,22 @@ namespace gma {
         ++len;
       }
 
-      result.push_back(std::string_view(start, len));
+      result.push_back(std::u32string_view(start, len));
     }
 
     return result;
   }
 
-  std::vector<std::string_view> split_in_paragraphs(std::string_view str) {
-    return split(str, "\n");
+  std::vector<std::u32string_view> split_in_paragraphs(std::u32string_view str) {
+    return split(str, U"\n");
   }
 
-  std::vector<std::string_view> split_in_words(std::string_view str) {
-    return split(str, " \t");
+  std::vector<std::u32string_view> split_in_words(std::u32string_view str) {
+    return split(str, U" \t");
   }
 
   struct ParagraphLine {
-    std::vector<std::string_view> words;
+    std::vector<std::u32string_view> words;
     float indent = 0.0f;
     float spacing = 0.0f;
   };
@@ -432,14 +838,14 @@ namespace gma {
     std::vector<ParagraphLine> lines;
   };
 
-  float compute_word_width(std::string_view word, unsigned character_size, Font& font) {
+  float compute_word_width(std::u32string_view word, unsigned character_size, Font& font) {
     assert(character_size > 0);
     assert(!word.empty());
 
     float width = 0.0f;
     uint32_t prev_codepoint = '\0';
 
-    for (uint32_t curr_codepoint : codepoints(word)) {
+    for (uint32_t curr_codepoint : word) {
       width += font.compute_kerning(prev_codepoint, curr_codepoint, character_size);
       prev_codepoint = curr_codepoint;
 
@@ -450,12 +856,12 @@ namespace gma {
     return width;
   }
 
-  std::vector<Paragraph> make_paragraphs(const char *str, float space_width, float paragraph_width, TextAlignement align, unsigned character_size, Font& font) {
-    std::vector<std::string_view> paragraphs = split_in_paragraphs(str);
+  std::vector<Paragraph> make_paragraphs(std::u32string_view str, float space_width, float paragraph_width, TextAlignement align, unsigned character_size, Font& font) {
+    std::vector<std::u32string_view> paragraphs = split_in_paragraphs(str);
     std::vector<Paragraph> result;
 
     for (auto raw_paragraph : paragraphs) {
-      std::vector<std::string_view> words = split_in_words(raw_paragraph);
+      std::vector<std::u32string_view> words = split_in_words(raw_paragraph);
 
       Paragraph paragraph;
 
@@ -594,7 +1000,10 @@ namespace gma {
     space_width += additional_space;
     float line_height = font->compute_line_spacing(character_size) * line_spacing;
 
-    auto paragraphs = make_paragraphs(string, space_width, paragraph_width, alignment, character_size, *font);
+    // decode once, the codepoints are shared by the layout and the vertex generation
+    std::u32string codepoints = decode_utf8(string);
+
+    auto paragraphs = make_paragraphs(codepoints, space_width, paragraph_width, alignment, character_size, *font);
     Vec2F position = { 0.0f, 0.0f };
     Vec2F min = position;
     Vec2F max = position;
@@ -606,7 +1015,7 @@ namespace gma {
         for (auto word : line.words) {
           uint32_t prev_codepoint = '\0';
 
-          for (auto curr_codepoint : codepoints(word)) {
+          for (uint32_t curr_codepoint : word) {
             position.x += font->compute_kerning(prev_codepoint, curr_codepoint, character_size);
             prev_codepoint = curr_codepoint;
 
@@ -711,6 +1120,19 @@ namespace gma {
   }
 
 
+  // a text can use an outline font or a bitmap font
+  static Font *slot_get_font(AgateVM *vm, ptrdiff_t slot) {
+    if (agateCheckTag<FontClass>(vm, slot)) {
+      return agateSlotGet<FontClass>(vm, slot);
+    }
+
+    if (agateCheckTag<BitmapFontClass>(vm, slot)) {
+      return agateSlotGet<BitmapFontClass>(vm, slot);
+    }
+
+    return nullptr;
+  }
+
   struct TextApi : TextClass {
     static void destroy(AgateVM *vm, const char *unit_name, const char *class_name, void *data) {
       auto text = static_cast<Text *>(data);
@@ -741,12 +1163,13 @@ namespace gma {
       assert(agateCheckTag<TextClass>(vm, 0));
       auto text = agateSlotGet<TextClass>(vm, 0);
 
-      if (!agateCheckTag<FontClass>(vm, 1)) {
+      text->font = slot_get_font(vm, 1);
+
+      if (text->font == nullptr) {
         agateError(vm, "Font parameter expected for `font`.");
         return;
       }
 
-      text->font = agateSlotGet<FontClass>(vm, 1);
       text->font_handle = agateSlotGetHandle(vm, 1);
 
       if (!agateCheck(vm, 2, text->string)) {
@@ -790,13 +1213,13 @@ namespace gma {
       assert(agateCheckTag<TextClass>(vm, 0));
       auto text = agateSlotGet<TextClass>(vm, 0);
 
-      if (!agateCheckTag<FontClass>(vm, 1)) {
+      auto font = slot_get_font(vm, 1);
+
+      if (font == nullptr) {
         agateError(vm, "Font parameter expected for `value`.");
         return;
       }
 
-      auto font = agateSlotGet<FontClass>(vm, 1);
-
       text->font = font;
       agateReleaseHandle(vm, text->font_handle);
       text->font_handle = agateSlotGetHandle(vm, 1);
@@ -1028,10 +1451,14 @@ namespace gma {
 
   void TextUnit::provide_support(Support & support) {
     support.add_class_handler(unit_name, FontClass::class_name, generic_handler<FontClass>(FontApi::destroy));
+    support.add_class_handler(unit_name, BitmapFontClass::class_name, generic_handler<BitmapFontClass>(BitmapFontApi::destroy));
     support.add_class_handler(unit_name, TextApi::class_name, generic_handler<TextClass>(TextApi::destroy));
 
     support.add_method(unit_name, FontApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init from_file(_)", FontApi::from_file);
 
+    support.add_method(unit_name, BitmapFontApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init from_file(_)", BitmapFontApi::from_file);
+    support.add_method(unit_name, BitmapFontApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "size", BitmapFontApi::get_size);
+
     support.add_method(unit_name, TextApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "init new(_,_,_)", TextApi::new3);
     support.add_method(unit_name, TextApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "font", TextApi::get_font);
     support.add_method(unit_name, TextApi::class_name, AGATE_FOREIGN_METHOD_INSTANCE, "font=(_)", TextApi::set_font);
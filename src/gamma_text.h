@@ -2,6 +2,7 @@
 #define GAMMA_TEXT_H
 
 #include <map>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -12,6 +13,7 @@
 #include "glad/glad.h"
 
 #include "gamma_color.h"
+#include "gamma_file.h"
 #include "gamma_math.h"
 #include "gamma_support.h"
 
@@ -48,15 +50,19 @@ namespace gma {
     std::vector<GlyphCache> cache_by_size;
   };
 
-  struct Font {
-    static FT_Library library;
-    FT_Stroker stroker;
+  // shared by all the fonts loaded from the same file
+  struct FontFace {
+    std::string filename;
+    FileMapping file;
+    int references = 0;
 
-    FT_Face face;
-    FT_UInt current_size;
-    FontCache *cache;
+    FT_Face face = nullptr;
+    FT_Stroker stroker = nullptr;
+    FT_UInt current_size = 0;
+    FontCache cache;
 
-    void destroy();
+    static FontFace *acquire(const char *filename);
+    static void release(FontFace *face);
 
     GLuint get_texture(FT_UInt size);
 
@@ -70,6 +76,75 @@ namespace gma {
     void set_character_size(FT_UInt size);
 
     float compute_line_spacing(FT_UInt size);
+  };
+
+  // pre-baked font in the AngelCode BMFont text format, all the pages are stacked in a single texture
+  struct BitmapFace {
+    float size = 0.0f;
+    float line_height = 0.0f;
+    float base = 0.0f;
+
+    GLuint texture = 0;
+    std::map<uint32_t, Glyph> glyphs;
+    std::map<std::tuple<uint32_t, uint32_t>, float> kernings;
+
+    static BitmapFace *load(const char *filename);
+    void destroy();
+
+    float compute_scale(FT_UInt requested_size) const {
+      return static_cast<float>(requested_size) / size;
+    }
+
+    Glyph compute_glyph(uint32_t codepoint, FT_UInt size);
+    float compute_kerning(uint32_t left, uint32_t right, FT_UInt size);
+    float compute_line_spacing(FT_UInt size);
+  };
+
+  enum class FontKind {
+    OUTLINE,
+    BITMAP,
+  };
+
+  struct Font {
+    static FT_Library library;
+    FontKind kind;
+    FontFace *face;
+    BitmapFace *bitmap;
+
+    void destroy();
+
+    GLuint get_texture(FT_UInt size) {
+      if (kind == FontKind::BITMAP) {
+        return bitmap->texture;
+      }
+
+      return face->get_texture(size);
+    }
+
+    // bitmap fonts have no outline, the plain glyph is used instead
+    Glyph compute_glyph(uint32_t codepoint, FT_UInt size, float outline_thickness) {
+      if (kind == FontKind::BITMAP) {
+        return bitmap->compute_glyph(codepoint, size);
+      }
+
+      return face->compute_glyph(codepoint, size, outline_thickness);
+    }
+
+    float compute_kerning(uint32_t left, uint32_t right, FT_UInt size) {
+      if (kind == FontKind::BITMAP) {
+        return bitmap->compute_kerning(left, right, size);
+      }
+
+      return face->compute_kerning(left, right, size);
+    }
+
+    float compute_line_spacing(FT_UInt size) {
+      if (kind == FontKind::BITMAP) {
+        return bitmap->compute_line_spacing(size);
+      }
+
+      return face->compute_line_spacing(size);
+    }
 
     static const char *error_message(FT_Error error);
   };
@@ -80,6 +155,12 @@ namespace gma {
     static constexpr uint64_t tag = compute_tag(unit_name, class_name);
   };
 
+  struct BitmapFontClass : TextUnit {
+    using type = Font;
+    static constexpr const char * class_name = "BitmapFont";
+    static constexpr uint64_t tag = compute_tag(unit_name, class_name);
+  };
+
 
   /*
    * Alignment
@@ -0,0 +1,139 @@
+#include "gamma_thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace gma {
+
+  /*
+   * Parallel loops
+   */
+
+  namespace {
+
+    // the bands of a parallel loop, shared with the jobs that may run after the loop has returned
+    struct ParallelBands {
+      std::atomic<int> next = 0;
+      std::atomic<int> done = 0;
+      std::mutex mutex;
+      std::condition_variable condition;
+    };
+
+  }
+
+  void parallel_for(int count, int grain, const std::function<void(int, int)>& function) {
+    if (count <= 0) {
+      return;
+    }
+
+    const int hardware = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+    const int bands = std::clamp(count / std::max(grain, 1), 1, hardware);
+
+    if (bands == 1) {
+      function(0, count);
+      return;
+    }
+
+    auto state = std::make_shared<ParallelBands>();
+    const std::function<void(int, int)> *callback = &function;
+
+    // each participant takes the next band until there are none left, a job that starts late does nothing
+    auto work = [state, callback, count, bands]() {
+      for (;;) {
+        const int band = state->next.fetch_add(1);
+
+        if (band >= bands) {
+          return;
+        }
+
+        const int begin = static_cast<int>(static_cast<int64_t>(count) * band / bands);
+        const int end = static_cast<int>(static_cast<int64_t>(count) * (band + 1) / bands);
+        (*callback)(begin, end);
+
+        if (state->done.fetch_add(1) + 1 == bands) {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          state->condition.notify_all();
+        }
+      }
+    };
+
+    auto & pool = WorkerPool::get();
+
+    for (int band = 1; band < bands; ++band) {
+      pool.submit(work);
+    }
+
+    // the calling thread works as well, so the loop completes even if the pool is busy with other jobs
+    work();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(lock, [&state, bands]() { return state->done.load() == bands; });
+  }
+
+  /*
+   * WorkerPool
+   */
+
+  WorkerPool::WorkerPool(int count) {
+    threads.reserve(count);
+
+    for (int i = 0; i < count; ++i) {
+      threads.emplace_back(&WorkerPool::run, this);
+    }
+  }
+
+  WorkerPool::~WorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopped = true;
+    }
+
+    condition.notify_all();
+
+    for (auto & thread : threads) {
+      thread.join();
+    }
+  }
+
+  void WorkerPool::submit(std::function<void()> job) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      jobs.push_back(std::move(job));
+    }
+
+    condition.notify_one();
+  }
+
+  WorkerPool& WorkerPool::get() {
+    // keep a core for the main thread
+    static WorkerPool pool(std::max(static_cast<int>(std::thread::hardware_concurrency()) - 1, 1));
+    return pool;
+  }
+
+  void WorkerPool::run() {
+    for (;;) {
+      std::function<void()> job;
+
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]() { return stopped || !jobs.empty(); });
+
+        if (jobs.empty()) {
+          assert(stopped);
+          return;
+        }
+
+        job = std::move(jobs.front());
+        jobs.pop_front();
+      }
+
+      job();
+    }
+  }
+
+}
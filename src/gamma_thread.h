@@ -0,0 +1,50 @@
+#ifndef GAMMA_THREAD_H
+#define GAMMA_THREAD_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gma {
+
+  /*
+   * Parallel loops
+   */
+
+  // split [0, count) in contiguous bands of at least `grain` items and call `function(begin, end)` on each band concurrently,
+  // the bands run on the shared WorkerPool and on the calling thread
+  void parallel_for(int count, int grain, const std::function<void(int, int)>& function);
+
+  /*
+   * WorkerPool
+   */
+
+  // background threads running jobs in submission order
+  struct WorkerPool {
+    std::vector<std::thread> threads;
+    std::deque<std::function<void()>> jobs;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stopped = false;
+
+    WorkerPool(int count);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    void submit(std::function<void()> job);
+
+    // shared pool, started on first use
+    static WorkerPool& get();
+
+  private:
+    void run();
+  };
+
+}
+
+#endif // GAMMA_THREAD_H
@@ -7,34 +7,165 @@
 #include <time.h>
 #endif
 
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <thread>
+
 #include "gamma_agate.h"
+#include "gamma_replay.h"
 
 namespace gma {
 
-  struct TimeApi : TimeClass {
-
-    static void now(AgateVM *vm) {
-      static const int64_t BILLION = INT64_C(1000000000);
+  int64_t time_now() {
+    static const int64_t BILLION = INT64_C(1000000000);
 
 #ifdef _MSC_VER
-      LARGE_INTEGER frequency;
-      QueryPerformanceFrequency(&frequency);
-      LARGE_INTEGER time;
-      QueryPerformanceCounter(&time);
-
-      int64_t integral = time.QuadPart / frequency.QuadPart;
-      int64_t fractional = time.QuadPart % frequency.QuadPart;
-      int64_t nanoseconds = integral * BILLION + fractional * BILLION / frequency.QuadPart;
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER time;
+    QueryPerformanceCounter(&time);
 
-      agateSlotSetInt(vm, AGATE_RETURN_SLOT, nanoseconds);
+    int64_t integral = time.QuadPart / frequency.QuadPart;
+    int64_t fractional = time.QuadPart % frequency.QuadPart;
+    return integral * BILLION + fractional * BILLION / frequency.QuadPart;
 #else
-      struct timespec tp;
-      clock_gettime(CLOCK_MONOTONIC, &tp);
-
-      int64_t nanoseconds = tp.tv_sec * BILLION + tp.tv_nsec;
+    struct timespec tp;
+    clock_gettime(CLOCK_MONOTONIC, &tp);
 
-      agateSlotSetInt(vm, AGATE_RETURN_SLOT, nanoseconds);
+    return tp.tv_sec * BILLION + tp.tv_nsec;
 #endif
+  }
+
+  void time_sleep_until(int64_t deadline) {
+    // the scheduler may wake up a millisecond or two late, so the sleep stops short of the deadline
+    static constexpr int64_t SpinMargin = INT64_C(2000000);
+
+    for (;;) {
+      const int64_t remaining = deadline - time_now();
+
+      if (remaining <= 0) {
+        return;
+      }
+
+      if (remaining > SpinMargin) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(remaining - SpinMargin));
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  /*
+   * StartupProfile
+   */
+
+  namespace {
+
+    constexpr std::size_t NoPhase = std::numeric_limits<std::size_t>::max();
+
+    double to_milliseconds(int64_t nanoseconds) {
+      return static_cast<double>(nanoseconds) / 1e6;
+    }
+
+  }
+
+  void StartupProfile::start(int64_t origin_time) {
+    enabled = true;
+    origin = origin_time;
+  }
+
+  std::size_t StartupProfile::begin(std::string name) {
+    if (!enabled || finished) {
+      return NoPhase;
+    }
+
+    phases.push_back({ std::move(name), depth, time_now() - origin, -1 });
+    ++depth;
+    return phases.size() - 1;
+  }
+
+  void StartupProfile::end(std::size_t index) {
+    if (index == NoPhase || phases[index].end != -1) {
+      return;
+    }
+
+    phases[index].end = time_now() - origin;
+    --depth;
+  }
+
+  void StartupProfile::finish() {
+    if (!enabled || finished) {
+      return;
+    }
+
+    const int64_t now = time_now() - origin;
+
+    for (auto & phase : phases) {
+      if (phase.end == -1) {
+        phase.end = now;
+      }
+    }
+
+    finished = true;
+    phases.push_back({ "total", 0, 0, now });
+
+    if (json_filename.empty()) {
+      print_breakdown();
+    } else if (!write_json()) {
+      std::fprintf(stderr, "Unable to write startup profile: '%s'.\n", json_filename.c_str());
+    }
+  }
+
+  StartupProfile& StartupProfile::get() {
+    static StartupProfile profile;
+    return profile;
+  }
+
+  void StartupProfile::print_breakdown() const {
+    std::fprintf(stderr, "Startup profile (ms):\n");
+
+    for (auto & phase : phases) {
+      const int indent = 2 + 2 * phase.depth;
+      const int width = 40 - indent;
+      std::fprintf(stderr, "%*s%-*s %10.3f  (at %10.3f)\n", indent, "", width, phase.name.c_str(), to_milliseconds(phase.end - phase.start), to_milliseconds(phase.start));
+    }
+  }
+
+  bool StartupProfile::write_json() const {
+    std::FILE *file = std::fopen(json_filename.c_str(), "w");
+
+    if (file == nullptr) {
+      return false;
+    }
+
+    std::fprintf(file, "{\n  \"unit\": \"ms\",\n  \"phases\": [\n");
+
+    for (std::size_t i = 0; i < phases.size(); ++i) {
+      auto & phase = phases[i];
+      // the names are unit names or fixed strings, they have nothing to escape but quotes and backslashes
+      std::string name;
+
+      for (char c : phase.name) {
+        if (c == '"' || c == '\\') {
+          name.push_back('\\');
+        }
+
+        name.push_back(c);
+      }
+
+      std::fprintf(file, "    { \"name\": \"%s\", \"depth\": %d, \"start\": %.3f, \"duration\": %.3f }%s\n", name.c_str(), phase.depth, to_milliseconds(phase.start), to_milliseconds(phase.end - phase.start), (i + 1 < phases.size()) ? "," : "");
+    }
+
+    std::fprintf(file, "  ]\n}\n");
+    return std::fclose(file) == 0;
+  }
+
+
+  struct TimeApi : TimeClass {
+
+    static void now(AgateVM *vm) {
+      agateSlotSetInt(vm, AGATE_RETURN_SLOT, Replay::get().now());
     }
 
     static void from_seconds(AgateVM *vm) {
@@ -1,6 +1,11 @@
 #ifndef GAMMA_TIME_H
 #define GAMMA_TIME_H
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include "gamma_support.h"
 
 namespace gma {
@@ -19,6 +24,65 @@ namespace gma {
     static constexpr uint64_t tag = compute_tag(unit_name, class_name);
   };
 
+  // nanoseconds of the monotonic clock
+  int64_t time_now();
+
+  // sleep until the deadline of the monotonic clock, the last moments are spent spinning for precision
+  void time_sleep_until(int64_t deadline);
+
+  /*
+   * StartupProfile
+   */
+
+  // timestamps of the startup phases, from the beginning of main() to the first displayed frame
+  struct StartupProfile {
+    struct Phase {
+      std::string name;
+      int depth;
+      int64_t start;
+      int64_t end; // -1 while the phase is running
+    };
+
+    bool enabled = false;
+    bool finished = false;
+    std::string json_filename; // empty to print the breakdown on the standard error
+    int64_t origin = 0;
+    int depth = 0;
+    std::vector<Phase> phases;
+
+    // `origin_time` is taken at the entry of main(), before the options are parsed
+    void start(int64_t origin_time);
+
+    std::size_t begin(std::string name);
+    void end(std::size_t index);
+
+    // close the running phases and report, only the first call has an effect
+    void finish();
+
+    static StartupProfile& get();
+
+  private:
+    void print_breakdown() const;
+    bool write_json() const;
+  };
+
+  // a phase that lasts until the end of the scope
+  struct StartupPhase {
+    std::size_t index;
+
+    StartupPhase(std::string name)
+    : index(StartupProfile::get().begin(std::move(name)))
+    {
+    }
+
+    ~StartupPhase() {
+      StartupProfile::get().end(index);
+    }
+
+    StartupPhase(const StartupPhase&) = delete;
+    StartupPhase& operator=(const StartupPhase&) = delete;
+  };
+
 }
 
 #endif // GAMMA_TIME_H
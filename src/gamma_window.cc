@@ -5,6 +5,8 @@
 
 #include "gamma_agate.h"
 #include "gamma_math.h"
+#include "gamma_sdl.h"
+#include "gamma_time.h"
 
 namespace gma {
 
@@ -36,6 +38,15 @@ namespace gma {
         return;
       }
 
+      window->ptr = nullptr;
+
+      StartupPhase phase("window");
+
+      if (!sdl_require(SDL_INIT_VIDEO)) {
+        agateError(vm, "Unable to initialize video: %s", SDL_GetError());
+        return;
+      }
+
       window->ptr = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, size.x, size.y, SDL_WINDOW_OPENGL);
 
       if (window->ptr == nullptr) {
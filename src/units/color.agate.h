@@ -0,0 +1,67 @@
+static char gamma_unit_color[] = {
+	0x23, 0x20, 0x67, 0x61, 0x6D, 0x6D, 0x61, 0x2C, 0x20, 0x47, 0x41, 0x4D, 0x65, 0x73, 0x20, 0x4D, 0x61, 0x64, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x41, 0x67, 0x61, 0x74, 0x65, 0x0A,
+	0x23, 0x20, 0x53, 0x50, 0x44, 0x58, 0x2D, 0x4C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x2D, 0x49, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3A, 0x20, 0x4D, 0x49, 0x54, 0x0A,
+	0x23, 0x20, 0x43, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x32, 0x32, 0x20, 0x4A, 0x75, 0x6C, 0x69, 0x65, 0x6E, 0x20, 0x42, 0x65, 0x72, 0x6E, 0x61, 0x72, 0x64, 0x0A,
+	0x0A,
+	0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x28, 0x72, 0x2C, 0x20, 0x67, 0x2C, 0x20, 0x62, 0x2C, 0x20, 0x61, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x72, 0x67, 0x62, 0x61, 0x33, 0x32, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x72, 0x67, 0x62, 0x32, 0x34, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x62, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x72, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x67, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x62, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x61, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x2B, 0x28, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x2D, 0x28, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x2A, 0x28, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x2F, 0x28, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x3D, 0x3D, 0x28, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x21, 0x3D, 0x28, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x64, 0x61, 0x72, 0x6B, 0x65, 0x72, 0x28, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x64, 0x61, 0x72, 0x6B, 0x65, 0x72, 0x28, 0x29, 0x20, 0x7B, 0x20, 0x2E, 0x64, 0x61, 0x72, 0x6B, 0x65, 0x72, 0x28, 0x30, 0x2E, 0x35, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x65, 0x72, 0x28, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x65, 0x72, 0x28, 0x29, 0x20, 0x7B, 0x20, 0x2E, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x65, 0x72, 0x28, 0x30, 0x2E, 0x35, 0x29, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x28, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x74, 0x6F, 0x5F, 0x73, 0x20, 0x7B, 0x20, 0x22, 0x28, 0x25, 0x28, 0x2E, 0x72, 0x29, 0x2C, 0x20, 0x25, 0x28, 0x2E, 0x67, 0x29, 0x2C, 0x20, 0x25, 0x28, 0x2E, 0x62, 0x29, 0x2C, 0x20, 0x25, 0x28, 0x2E, 0x61, 0x29, 0x29, 0x22, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6C, 0x65, 0x72, 0x70, 0x28, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x30, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x31, 0x2C, 0x20, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x42, 0x4C, 0x41, 0x43, 0x4B, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x57, 0x48, 0x49, 0x54, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x45, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x52, 0x45, 0x45, 0x4E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x42, 0x4C, 0x55, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x59, 0x41, 0x4E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x41, 0x47, 0x45, 0x4E, 0x54, 0x41, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x59, 0x45, 0x4C, 0x4C, 0x4F, 0x57, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4F, 0x52, 0x41, 0x4E, 0x47, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x4F, 0x53, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x48, 0x41, 0x52, 0x54, 0x52, 0x45, 0x55, 0x53, 0x45, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x50, 0x52, 0x49, 0x4E, 0x47, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x56, 0x49, 0x4F, 0x4C, 0x45, 0x54, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x41, 0x5A, 0x55, 0x52, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x54, 0x52, 0x41, 0x4E, 0x53, 0x50, 0x41, 0x52, 0x45, 0x4E, 0x54, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4F, 0x50, 0x41, 0x51, 0x55, 0x45, 0x28, 0x76, 0x61, 0x6C, 0x29, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x52, 0x41, 0x59, 0x28, 0x76, 0x61, 0x6C, 0x29, 0x20, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x76, 0x61, 0x6C, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x28, 0x72, 0x2C, 0x20, 0x67, 0x2C, 0x20, 0x62, 0x29, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x72, 0x2C, 0x20, 0x67, 0x2C, 0x20, 0x62, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x28, 0x72, 0x2C, 0x20, 0x67, 0x2C, 0x20, 0x62, 0x2C, 0x20, 0x61, 0x29, 0x20, 0x7B, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x72, 0x2C, 0x20, 0x67, 0x2C, 0x20, 0x62, 0x2C, 0x20, 0x61, 0x29, 0x20, 0x7D, 0x0A,
+	0x7D, 0x0A,
+	0x00
+};
+// size: 1715
@@ -0,0 +1,477 @@
+static char gamma_unit_event[] = {
+	0x23, 0x20, 0x67, 0x61, 0x6D, 0x6D, 0x61, 0x2C, 0x20, 0x47, 0x41, 0x4D, 0x65, 0x73, 0x20, 0x4D, 0x61, 0x64, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x41, 0x67, 0x61, 0x74, 0x65, 0x0A,
+	0x23, 0x20, 0x53, 0x50, 0x44, 0x58, 0x2D, 0x4C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x2D, 0x49, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3A, 0x20, 0x4D, 0x49, 0x54, 0x0A,
+	0x23, 0x20, 0x43, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x32, 0x32, 0x20, 0x4A, 0x75, 0x6C, 0x69, 0x65, 0x6E, 0x20, 0x42, 0x65, 0x72, 0x6E, 0x61, 0x72, 0x64, 0x0A,
+	0x0A,
+	0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x22, 0x67, 0x61, 0x6D, 0x6D, 0x61, 0x2F, 0x6D, 0x61, 0x74, 0x68, 0x22, 0x0A,
+	0x0A,
+	0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x70, 0x6F, 0x6C, 0x6C, 0x28, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x70, 0x6F, 0x6C, 0x6C, 0x5F, 0x61, 0x6C, 0x6C, 0x28, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x77, 0x61, 0x69, 0x74, 0x28, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x77, 0x61, 0x69, 0x74, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x23, 0x20, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x65, 0x63, 0x75, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6D, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64, 0x72, 0x6F, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x78, 0x69, 0x73, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6D, 0x6F, 0x76, 0x65, 0x64, 0x20, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6F, 0x6C, 0x64, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x63, 0x6F, 0x61, 0x6C, 0x65, 0x73, 0x63, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x63, 0x6F, 0x61, 0x6C, 0x65, 0x73, 0x63, 0x69, 0x6E, 0x67, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x61, 0x78, 0x69, 0x73, 0x5F, 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6F, 0x6C, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x61, 0x78, 0x69, 0x73, 0x5F, 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6F, 0x6C, 0x64, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x51, 0x55, 0x49, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x45, 0x53, 0x49, 0x5A, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x4C, 0x4F, 0x53, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x4F, 0x43, 0x55, 0x53, 0x5F, 0x47, 0x41, 0x49, 0x4E, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x4F, 0x43, 0x55, 0x53, 0x5F, 0x4C, 0x4F, 0x53, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x48, 0x4F, 0x57, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x48, 0x49, 0x44, 0x44, 0x45, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x45, 0x58, 0x50, 0x4F, 0x53, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x49, 0x4E, 0x49, 0x4D, 0x49, 0x5A, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x41, 0x58, 0x49, 0x4D, 0x49, 0x5A, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x45, 0x53, 0x54, 0x4F, 0x52, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4B, 0x45, 0x59, 0x5F, 0x50, 0x52, 0x45, 0x53, 0x53, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4B, 0x45, 0x59, 0x5F, 0x52, 0x45, 0x50, 0x45, 0x41, 0x54, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4B, 0x45, 0x59, 0x5F, 0x52, 0x45, 0x4C, 0x45, 0x41, 0x53, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x4F, 0x55, 0x53, 0x45, 0x5F, 0x57, 0x48, 0x45, 0x45, 0x4C, 0x5F, 0x53, 0x43, 0x52, 0x4F, 0x4C, 0x4C, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x4F, 0x55, 0x53, 0x45, 0x5F, 0x42, 0x55, 0x54, 0x54, 0x4F, 0x4E, 0x5F, 0x50, 0x52, 0x45, 0x53, 0x53, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x4F, 0x55, 0x53, 0x45, 0x5F, 0x42, 0x55, 0x54, 0x54, 0x4F, 0x4E, 0x5F, 0x52, 0x45, 0x4C, 0x45, 0x41, 0x53, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x4F, 0x55, 0x53, 0x45, 0x5F, 0x4D, 0x4F, 0x56, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x4F, 0x55, 0x53, 0x45, 0x5F, 0x45, 0x4E, 0x54, 0x45, 0x52, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x4F, 0x55, 0x53, 0x45, 0x5F, 0x4C, 0x45, 0x46, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x41, 0x4D, 0x45, 0x50, 0x41, 0x44, 0x5F, 0x42, 0x55, 0x54, 0x54, 0x4F, 0x4E, 0x5F, 0x50, 0x52, 0x45, 0x53, 0x53, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x41, 0x4D, 0x45, 0x50, 0x41, 0x44, 0x5F, 0x42, 0x55, 0x54, 0x54, 0x4F, 0x4E, 0x5F, 0x52, 0x45, 0x4C, 0x45, 0x41, 0x53, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x41, 0x4D, 0x45, 0x50, 0x41, 0x44, 0x5F, 0x41, 0x58, 0x49, 0x53, 0x5F, 0x4D, 0x4F, 0x56, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x41, 0x4D, 0x45, 0x50, 0x41, 0x44, 0x5F, 0x43, 0x4F, 0x4E, 0x4E, 0x45, 0x43, 0x54, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x41, 0x4D, 0x45, 0x50, 0x41, 0x44, 0x5F, 0x44, 0x49, 0x53, 0x43, 0x4F, 0x4E, 0x4E, 0x45, 0x43, 0x54, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x54, 0x45, 0x58, 0x54, 0x5F, 0x45, 0x4E, 0x54, 0x45, 0x52, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x54, 0x4F, 0x55, 0x43, 0x48, 0x5F, 0x42, 0x45, 0x47, 0x41, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x54, 0x4F, 0x55, 0x43, 0x48, 0x5F, 0x4D, 0x4F, 0x56, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x54, 0x4F, 0x55, 0x43, 0x48, 0x5F, 0x45, 0x4E, 0x44, 0x45, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x55, 0x4E, 0x4B, 0x4E, 0x4F, 0x57, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x5F, 0x5F, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x4B, 0x65, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x69, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x63, 0x61, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x6B, 0x65, 0x79, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x68, 0x61, 0x73, 0x5F, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x28, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x29, 0x20, 0x7B, 0x20, 0x28, 0x2E, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x73, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x29, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x20, 0x7D, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x4D, 0x6F, 0x75, 0x73, 0x65, 0x4D, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x69, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x63, 0x6F, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x6D, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x23, 0x20, 0x69, 0x73, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x28, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x4D, 0x6F, 0x75, 0x73, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x69, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x63, 0x6F, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x4D, 0x6F, 0x75, 0x73, 0x65, 0x57, 0x68, 0x65, 0x65, 0x6C, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x69, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x23, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x47, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x23, 0x20, 0x20, 0x20, 0x69, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x23, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x23, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x23, 0x20, 0x7D, 0x0A,
+	0x23, 0x0A,
+	0x23, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x47, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x41, 0x78, 0x69, 0x73, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x23, 0x20, 0x20, 0x20, 0x69, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x23, 0x20, 0x20, 0x20, 0x61, 0x78, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x23, 0x20, 0x20, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x23, 0x20, 0x7D, 0x0A,
+	0x23, 0x0A,
+	0x23, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x47, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x43, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x23, 0x20, 0x20, 0x20, 0x68, 0x77, 0x5F, 0x69, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x23, 0x20, 0x7D, 0x0A,
+	0x23, 0x0A,
+	0x23, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x47, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x44, 0x69, 0x73, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x23, 0x20, 0x20, 0x20, 0x69, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x23, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x69, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x5F, 0x5F, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x52, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x23, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x70, 0x6F, 0x6C, 0x6C, 0x5F, 0x61, 0x6C, 0x6C, 0x28, 0x29, 0x2C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x70, 0x65, 0x72, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x0A,
+	0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x5B, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x69, 0x64, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x63, 0x61, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x6B, 0x65, 0x79, 0x63, 0x6F, 0x64, 0x65, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x73, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x68, 0x61, 0x73, 0x5F, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2C, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x29, 0x20, 0x7B, 0x20, 0x28, 0x2E, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x73, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x29, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x73, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x63, 0x6F, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x73, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x6D, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x78, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x79, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x64, 0x78, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x64, 0x79, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x23, 0x20, 0x6B, 0x65, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2C, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x29, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x70, 0x65, 0x72, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A,
+	0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6B, 0x65, 0x79, 0x5F, 0x64, 0x6F, 0x77, 0x6E, 0x28, 0x73, 0x63, 0x61, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x28, 0x73, 0x63, 0x61, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6B, 0x65, 0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x64, 0x28, 0x73, 0x63, 0x61, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x64, 0x6F, 0x77, 0x6E, 0x28, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x28, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x64, 0x28, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x63, 0x6F, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x5F, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x73, 0x6C, 0x6F, 0x74, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x5F, 0x69, 0x64, 0x28, 0x73, 0x6C, 0x6F, 0x74, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x64, 0x6F, 0x77, 0x6E, 0x28, 0x73, 0x6C, 0x6F, 0x74, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x28, 0x73, 0x6C, 0x6F, 0x74, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x64, 0x28, 0x73, 0x6C, 0x6F, 0x74, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x5F, 0x61, 0x78, 0x69, 0x73, 0x28, 0x73, 0x6C, 0x6F, 0x74, 0x2C, 0x20, 0x61, 0x78, 0x69, 0x73, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x23, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x62, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x2C, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x2C, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x78, 0x65, 0x73, 0x2C, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x20, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x29, 0x0A,
+	0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x41, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x74, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x28, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x61, 0x64, 0x64, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6B, 0x65, 0x79, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x73, 0x63, 0x61, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x5F, 0x61, 0x78, 0x69, 0x73, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x61, 0x78, 0x69, 0x73, 0x2C, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x64, 0x65, 0x61, 0x64, 0x7A, 0x6F, 0x6E, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x5F, 0x73, 0x6C, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x5F, 0x73, 0x6C, 0x6F, 0x74, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x64, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x4D, 0x6F, 0x75, 0x73, 0x65, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x45, 0x46, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x49, 0x44, 0x44, 0x4C, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x58, 0x31, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x58, 0x32, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x53, 0x63, 0x61, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x28, 0x73, 0x63, 0x61, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x28, 0x73, 0x63, 0x61, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x55, 0x4E, 0x4B, 0x4E, 0x4F, 0x57, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x41, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x42, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x48, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x49, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4A, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4F, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x51, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x55, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x56, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x57, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x58, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x59, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5A, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x31, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x32, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x33, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x34, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x35, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x36, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x37, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x38, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x39, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x30, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x45, 0x54, 0x55, 0x52, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x45, 0x53, 0x43, 0x41, 0x50, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x42, 0x41, 0x43, 0x4B, 0x53, 0x50, 0x41, 0x43, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x54, 0x41, 0x42, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x50, 0x41, 0x43, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x49, 0x4E, 0x55, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x45, 0x51, 0x55, 0x41, 0x4C, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x45, 0x46, 0x54, 0x5F, 0x42, 0x52, 0x41, 0x43, 0x4B, 0x45, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x5F, 0x42, 0x52, 0x41, 0x43, 0x4B, 0x45, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x42, 0x41, 0x43, 0x4B, 0x53, 0x4C, 0x41, 0x53, 0x48, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x45, 0x4D, 0x49, 0x43, 0x4F, 0x4C, 0x4F, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x41, 0x50, 0x4F, 0x53, 0x54, 0x52, 0x4F, 0x50, 0x48, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x52, 0x41, 0x56, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x4F, 0x4D, 0x4D, 0x41, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x45, 0x52, 0x49, 0x4F, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x4C, 0x41, 0x53, 0x48, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x41, 0x50, 0x53, 0x5F, 0x4C, 0x4F, 0x43, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x31, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x32, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x33, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x34, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x35, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x36, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x37, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x38, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x39, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x31, 0x30, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x31, 0x31, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x31, 0x32, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x52, 0x49, 0x4E, 0x54, 0x5F, 0x53, 0x43, 0x52, 0x45, 0x45, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x43, 0x52, 0x4F, 0x4C, 0x4C, 0x5F, 0x4C, 0x4F, 0x43, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x41, 0x55, 0x53, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x49, 0x4E, 0x53, 0x45, 0x52, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x48, 0x4F, 0x4D, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x41, 0x47, 0x45, 0x5F, 0x55, 0x50, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x44, 0x45, 0x4C, 0x45, 0x54, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x45, 0x4E, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x41, 0x47, 0x45, 0x5F, 0x44, 0x4F, 0x57, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x45, 0x46, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x44, 0x4F, 0x57, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x55, 0x50, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x5F, 0x4C, 0x4F, 0x43, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x44, 0x49, 0x56, 0x49, 0x44, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x4D, 0x55, 0x4C, 0x54, 0x49, 0x50, 0x4C, 0x59, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x4D, 0x49, 0x4E, 0x55, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x50, 0x4C, 0x55, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x45, 0x4E, 0x54, 0x45, 0x52, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x31, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x32, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x33, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x34, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x35, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x36, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x37, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x38, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x39, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x30, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x50, 0x45, 0x52, 0x49, 0x4F, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x41, 0x50, 0x50, 0x4C, 0x49, 0x43, 0x41, 0x54, 0x49, 0x4F, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x4B, 0x65, 0x79, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x28, 0x6B, 0x65, 0x79, 0x63, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6E, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x28, 0x6B, 0x65, 0x79, 0x63, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x55, 0x4E, 0x4B, 0x4E, 0x4F, 0x57, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x45, 0x54, 0x55, 0x52, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x45, 0x53, 0x43, 0x41, 0x50, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x42, 0x41, 0x43, 0x4B, 0x53, 0x50, 0x41, 0x43, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x54, 0x41, 0x42, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x50, 0x41, 0x43, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x45, 0x58, 0x43, 0x4C, 0x41, 0x49, 0x4D, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x51, 0x55, 0x4F, 0x54, 0x45, 0x5F, 0x44, 0x4F, 0x55, 0x42, 0x4C, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x48, 0x41, 0x53, 0x48, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x45, 0x52, 0x43, 0x45, 0x4E, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x44, 0x4F, 0x4C, 0x4C, 0x41, 0x52, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x41, 0x4D, 0x50, 0x45, 0x52, 0x53, 0x41, 0x4E, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x51, 0x55, 0x4F, 0x54, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x45, 0x46, 0x54, 0x5F, 0x50, 0x41, 0x52, 0x45, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x5F, 0x50, 0x41, 0x52, 0x45, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x41, 0x53, 0x54, 0x45, 0x52, 0x49, 0x53, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x4C, 0x55, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x4F, 0x4D, 0x4D, 0x41, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x49, 0x4E, 0x55, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x45, 0x52, 0x49, 0x4F, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x4C, 0x41, 0x53, 0x48, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x30, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x31, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x32, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x33, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x34, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x35, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x36, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x37, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x38, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x39, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x4F, 0x4C, 0x4F, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x45, 0x4D, 0x49, 0x43, 0x4F, 0x4C, 0x4F, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x45, 0x53, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x45, 0x51, 0x55, 0x41, 0x4C, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x52, 0x45, 0x41, 0x54, 0x45, 0x52, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x51, 0x55, 0x45, 0x53, 0x54, 0x49, 0x4F, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x41, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x45, 0x46, 0x54, 0x5F, 0x42, 0x52, 0x41, 0x43, 0x4B, 0x45, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x42, 0x41, 0x43, 0x4B, 0x53, 0x4C, 0x41, 0x53, 0x48, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x5F, 0x42, 0x52, 0x41, 0x43, 0x4B, 0x45, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x41, 0x52, 0x45, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x55, 0x4E, 0x44, 0x45, 0x52, 0x53, 0x43, 0x4F, 0x52, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x42, 0x41, 0x43, 0x4B, 0x51, 0x55, 0x4F, 0x54, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x41, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x42, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x48, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x49, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4A, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4F, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x51, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x55, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x56, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x57, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x58, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x59, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5A, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x41, 0x50, 0x53, 0x5F, 0x4C, 0x4F, 0x43, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x31, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x32, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x33, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x34, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x35, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x36, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x37, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x38, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x39, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x31, 0x30, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x31, 0x31, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x31, 0x32, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x52, 0x49, 0x4E, 0x54, 0x5F, 0x53, 0x43, 0x52, 0x45, 0x45, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x43, 0x52, 0x4F, 0x4C, 0x4C, 0x5F, 0x4C, 0x4F, 0x43, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x41, 0x55, 0x53, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x49, 0x4E, 0x53, 0x45, 0x52, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x48, 0x4F, 0x4D, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x41, 0x47, 0x45, 0x5F, 0x55, 0x50, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x44, 0x45, 0x4C, 0x45, 0x54, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x45, 0x4E, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x50, 0x41, 0x47, 0x45, 0x5F, 0x44, 0x4F, 0x57, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x45, 0x46, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x44, 0x4F, 0x57, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x55, 0x50, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x5F, 0x4C, 0x4F, 0x43, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x44, 0x49, 0x56, 0x49, 0x44, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x4D, 0x55, 0x4C, 0x54, 0x49, 0x50, 0x4C, 0x59, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x4D, 0x49, 0x4E, 0x55, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x50, 0x4C, 0x55, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x45, 0x4E, 0x54, 0x45, 0x52, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x31, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x32, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x33, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x34, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x35, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x36, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x37, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x38, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x39, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x30, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x50, 0x41, 0x44, 0x5F, 0x50, 0x45, 0x52, 0x49, 0x4F, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x41, 0x50, 0x50, 0x4C, 0x49, 0x43, 0x41, 0x54, 0x49, 0x4F, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x4D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x4F, 0x4E, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x53, 0x48, 0x49, 0x46, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x53, 0x48, 0x49, 0x46, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x48, 0x49, 0x46, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x43, 0x54, 0x52, 0x4C, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x43, 0x54, 0x52, 0x4C, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x54, 0x52, 0x4C, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x41, 0x4C, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x41, 0x4C, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x41, 0x4C, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x47, 0x55, 0x49, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x47, 0x55, 0x49, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x55, 0x49, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x55, 0x4D, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x43, 0x41, 0x50, 0x53, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4D, 0x4F, 0x44, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x47, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x28, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x49, 0x4E, 0x56, 0x41, 0x4C, 0x49, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x41, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x42, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x58, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x59, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x42, 0x41, 0x43, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x47, 0x55, 0x49, 0x44, 0x45, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x53, 0x54, 0x41, 0x52, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x45, 0x46, 0x54, 0x5F, 0x53, 0x54, 0x49, 0x43, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x5F, 0x53, 0x54, 0x49, 0x43, 0x4B, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x45, 0x46, 0x54, 0x5F, 0x53, 0x48, 0x4F, 0x55, 0x4C, 0x44, 0x45, 0x52, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x5F, 0x53, 0x48, 0x4F, 0x55, 0x4C, 0x44, 0x45, 0x52, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x44, 0x50, 0x41, 0x44, 0x5F, 0x55, 0x50, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x44, 0x50, 0x41, 0x44, 0x5F, 0x44, 0x4F, 0x57, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x44, 0x50, 0x41, 0x44, 0x5F, 0x4C, 0x45, 0x46, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x44, 0x50, 0x41, 0x44, 0x5F, 0x52, 0x49, 0x47, 0x48, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x47, 0x61, 0x6D, 0x65, 0x70, 0x61, 0x64, 0x41, 0x78, 0x69, 0x73, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x28, 0x61, 0x78, 0x69, 0x73, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x49, 0x4E, 0x56, 0x41, 0x4C, 0x49, 0x44, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x45, 0x46, 0x54, 0x5F, 0x58, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4C, 0x45, 0x46, 0x54, 0x5F, 0x59, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x5F, 0x58, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x5F, 0x59, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x5F, 0x4C, 0x45, 0x46, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x5F, 0x52, 0x49, 0x47, 0x48, 0x54, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x69, 0x67, 0x6E, 0x0A,
+	0x7D, 0x0A,
+	0x00
+};
+// size: 10702
@@ -0,0 +1,301 @@
+static char gamma_unit_scene[] = {
+	0x23, 0x20, 0x67, 0x61, 0x6D, 0x6D, 0x61, 0x2C, 0x20, 0x47, 0x41, 0x4D, 0x65, 0x73, 0x20, 0x4D, 0x61, 0x64, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x41, 0x67, 0x61, 0x74, 0x65, 0x0A,
+	0x23, 0x20, 0x53, 0x50, 0x44, 0x58, 0x2D, 0x4C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x2D, 0x49, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3A, 0x20, 0x4D, 0x49, 0x54, 0x0A,
+	0x23, 0x20, 0x43, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x32, 0x32, 0x20, 0x4A, 0x75, 0x6C, 0x69, 0x65, 0x6E, 0x20, 0x42, 0x65, 0x72, 0x6E, 0x61, 0x72, 0x64, 0x0A,
+	0x0A,
+	0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x22, 0x67, 0x61, 0x6D, 0x6D, 0x61, 0x2F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x0A,
+	0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x22, 0x67, 0x61, 0x6D, 0x6D, 0x61, 0x2F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x41, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x74, 0x2C, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x0A,
+	0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x22, 0x67, 0x61, 0x6D, 0x6D, 0x61, 0x2F, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x43, 0x6C, 0x6F, 0x63, 0x6B, 0x2C, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x0A,
+	0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x22, 0x67, 0x61, 0x6D, 0x6D, 0x61, 0x2F, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x2C, 0x20, 0x52, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2C, 0x20, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x0A,
+	0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x22, 0x67, 0x61, 0x6D, 0x6D, 0x61, 0x2F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x0A,
+	0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x22, 0x67, 0x61, 0x6D, 0x6D, 0x61, 0x2F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x0A,
+	0x0A,
+	0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x53, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x28, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x42, 0x4C, 0x41, 0x43, 0x4B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x5F, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x3D, 0x20, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x2E, 0x6E, 0x65, 0x77, 0x5F, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x29, 0x2C, 0x20, 0x28, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5F, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x3D, 0x20, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x2E, 0x6E, 0x65, 0x77, 0x5F, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6E, 0x28, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x29, 0x2C, 0x20, 0x28, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x73, 0x20, 0x3D, 0x20, 0x5B, 0x20, 0x40, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x5F, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x2C, 0x20, 0x40, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5F, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x20, 0x41, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x74, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x6D, 0x6F, 0x64, 0x65, 0x6C, 0x73, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x5F, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5F, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x70, 0x61, 0x75, 0x73, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x7B, 0x20, 0x40, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x7B, 0x20, 0x40, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x7B, 0x20, 0x40, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x7B, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x28, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x29, 0x20, 0x7B, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x20, 0x7B, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x28, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x2E, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x5F, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x5F, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x28, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x2E, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x5F, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5F, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x28, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x5F, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x5F, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x28, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x3D, 0x20, 0x40, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x5F, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x40, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x5F, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x2E, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x28, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x5F, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5F, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x28, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x3D, 0x20, 0x40, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5F, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x40, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5F, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x2E, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x28, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7B, 0x20, 0x40, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x7B, 0x20, 0x40, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x70, 0x61, 0x75, 0x73, 0x65, 0x64, 0x20, 0x7B, 0x20, 0x40, 0x70, 0x61, 0x75, 0x73, 0x65, 0x64, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x70, 0x61, 0x75, 0x73, 0x65, 0x64, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x7B, 0x20, 0x40, 0x70, 0x61, 0x75, 0x73, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x20, 0x7B, 0x20, 0x40, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x7B, 0x20, 0x40, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x20, 0x7B, 0x20, 0x40, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x20, 0x7B, 0x20, 0x40, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x5F, 0x5F, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x43, 0x4C, 0x4F, 0x53, 0x45, 0x44, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x2E, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x29, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x5F, 0x5F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x28, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x40, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x28, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x29, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x5F, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x40, 0x70, 0x61, 0x75, 0x73, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x6D, 0x6F, 0x64, 0x65, 0x6C, 0x20, 0x69, 0x6E, 0x20, 0x40, 0x6D, 0x6F, 0x64, 0x65, 0x6C, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x6C, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x40, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x5F, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x40, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5F, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x5F, 0x5F, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x28, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x40, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x2E, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x28, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x7D, 0x0A,
+	0x0A,
+	0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x53, 0x63, 0x65, 0x6E, 0x65, 0x4D, 0x61, 0x6E, 0x61, 0x67, 0x65, 0x72, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x28, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x52, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x40, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x73, 0x69, 0x7A, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x73, 0x69, 0x7A, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x73, 0x65, 0x67, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x6F, 0x6E, 0x5F, 0x64, 0x65, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x64, 0x72, 0x61, 0x77, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x23, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x6E, 0x20, 0x64, 0x65, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x61, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x72, 0x65, 0x64, 0x72, 0x61, 0x77, 0x0A,
+	0x20, 0x20, 0x6F, 0x6E, 0x5F, 0x64, 0x65, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x7B, 0x20, 0x40, 0x6F, 0x6E, 0x5F, 0x64, 0x65, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x6F, 0x6E, 0x5F, 0x64, 0x65, 0x6D, 0x61, 0x6E, 0x64, 0x3D, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x7B, 0x20, 0x40, 0x6F, 0x6E, 0x5F, 0x64, 0x65, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x5F, 0x72, 0x65, 0x64, 0x72, 0x61, 0x77, 0x28, 0x29, 0x20, 0x7B, 0x20, 0x40, 0x72, 0x65, 0x64, 0x72, 0x61, 0x77, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x20, 0x40, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x20, 0x40, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x2B, 0x20, 0x31, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x40, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3E, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x20, 0x40, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x2D, 0x20, 0x31, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x72, 0x75, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x43, 0x6C, 0x6F, 0x63, 0x6B, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x57, 0x48, 0x49, 0x54, 0x45, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x21, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x26, 0x26, 0x20, 0x40, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x74, 0x6F, 0x5F, 0x61, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x5B, 0x2D, 0x31, 0x5D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x70, 0x61, 0x75, 0x73, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x64, 0x72, 0x61, 0x77, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x21, 0x40, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x26, 0x26, 0x20, 0x40, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x40, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x2E, 0x5F, 0x5F, 0x77, 0x61, 0x69, 0x74, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x70, 0x6F, 0x6C, 0x6C, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x5F, 0x5F, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x70, 0x6F, 0x6C, 0x6C, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x5F, 0x5F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x28, 0x40, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x2E, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x5F, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x5F, 0x74, 0x6F, 0x28, 0x40, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x5F, 0x5F, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x28, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x64, 0x72, 0x61, 0x77, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x73, 0x65, 0x67, 0x75, 0x65, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x5F, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x6E, 0x64, 0x5F, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x20, 0x40, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2C, 0x20, 0x40, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2C, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x5F, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x6E, 0x64, 0x5F, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2C, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2C, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x5F, 0x74, 0x6F, 0x28, 0x40, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x3D, 0x20, 0x40, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x64, 0x72, 0x61, 0x77, 0x5F, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x40, 0x73, 0x65, 0x67, 0x75, 0x65, 0x2C, 0x20, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x6E, 0x65, 0x77, 0x28, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x40, 0x73, 0x65, 0x67, 0x75, 0x65, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x67, 0x63, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x69, 0x73, 0x20, 0x53, 0x63, 0x65, 0x6E, 0x65, 0x2C, 0x20, 0x22, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x53, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x22, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5B, 0x2D, 0x31, 0x5D, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x61, 0x6C, 0x6C, 0x20, 0x7B, 0x7C, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x7C, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x69, 0x73, 0x20, 0x53, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x7D, 0x2C, 0x20, 0x22, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x53, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x22, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5B, 0x2D, 0x31, 0x5D, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x5F, 0x61, 0x6C, 0x6C, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x5B, 0x2D, 0x31, 0x5D, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x70, 0x6F, 0x70, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x28, 0x21, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20, 0x22, 0x55, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x6F, 0x70, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x22, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x65, 0x72, 0x61, 0x73, 0x65, 0x28, 0x2D, 0x31, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5B, 0x2D, 0x31, 0x5D, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x70, 0x6F, 0x70, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x40, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x23, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x73, 0x70, 0x65, 0x6E, 0x74, 0x20, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x61, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x0A,
+	0x20, 0x20, 0x5F, 0x5F, 0x77, 0x61, 0x69, 0x74, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x40, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x6D, 0x69, 0x6E, 0x69, 0x6D, 0x69, 0x7A, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x6E, 0x6F, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x2C, 0x20, 0x61, 0x20, 0x66, 0x65, 0x77, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x77, 0x61, 0x69, 0x74, 0x28, 0x54, 0x69, 0x6D, 0x65, 0x2E, 0x66, 0x72, 0x6F, 0x6D, 0x5F, 0x6D, 0x69, 0x6C, 0x6C, 0x69, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x28, 0x31, 0x30, 0x30, 0x29, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x2E, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x40, 0x6F, 0x6E, 0x5F, 0x64, 0x65, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x26, 0x26, 0x20, 0x21, 0x40, 0x72, 0x65, 0x64, 0x72, 0x61, 0x77, 0x20, 0x26, 0x26, 0x20, 0x40, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x26, 0x26, 0x20, 0x21, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x77, 0x61, 0x69, 0x74, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x2E, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x5F, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x6E, 0x64, 0x5F, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x5F, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x2C, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2C, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x5F, 0x74, 0x6F, 0x28, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x5F, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x5B, 0x2D, 0x31, 0x5D, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x2E, 0x5F, 0x5F, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x28, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x29, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+	0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x0A,
+	0x20, 0x20, 0x7D, 0x0A,
+	0x7D, 0x0A,
+	0x00
+};
+// size: 6343